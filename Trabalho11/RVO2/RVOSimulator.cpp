@@ -164,6 +164,24 @@ namespace RVO {
 	{
 		kdTree_->buildAgentTree();
 
+		if (parallelFor_) {
+			parallelFor_(agents_.size(), [this](size_t begin, size_t end) {
+				for (size_t i = begin; i < end; ++i) {
+					agents_[i]->computeNeighbors();
+					agents_[i]->computeNewVelocity();
+				}
+			});
+
+			parallelFor_(agents_.size(), [this](size_t begin, size_t end) {
+				for (size_t i = begin; i < end; ++i) {
+					agents_[i]->update();
+				}
+			});
+
+			globalTime_ += timeStep_;
+			return;
+		}
+
 #ifdef _OPENMP
 #pragma omp parallel for
 #endif
@@ -366,4 +384,9 @@ namespace RVO {
 	{
 		timeStep_ = timeStep;
 	}
+
+	void RVOSimulator::setParallelFor(const ParallelFor &parallelFor)
+	{
+		parallelFor_ = parallelFor;
+	}
 }
@@ -39,6 +39,7 @@
  */
 
 #include <cstddef>
+#include <functional>
 #include <limits>
 #include <vector>
 
@@ -80,6 +81,13 @@ namespace RVO {
 	 */
 	class RVOSimulator {
 	public:
+		/**
+		 * \brief      Runs body(begin, end) over disjoint ranges that cover
+		 *             [0, count) and returns only after all of them finished.
+		 *             The ranges may run concurrently.
+		 */
+		typedef std::function<void(size_t count, const std::function<void(size_t begin, size_t end)> &body)> ParallelFor;
+
 		/**
 		 * \brief      Constructs a simulator instance.
 		 */
@@ -575,6 +583,16 @@ namespace RVO {
 		 */
 		void setTimeStep(float timeStep);
 
+		/**
+		 * \brief      Sets the loop used by doStep() for the per-agent
+		 *             neighbor, velocity and update passes. Each agent
+		 *             only writes its own state in those passes. When no
+		 *             loop is set, doStep() uses OpenMP if available.
+		 * \param      parallelFor     The parallel loop, or an empty
+		 *                             function to restore the default.
+		 */
+		void setParallelFor(const ParallelFor &parallelFor);
+
 	private:
 		std::vector<Agent *> agents_;
 		Agent *defaultAgent_;
@@ -582,6 +600,7 @@ namespace RVO {
 		KdTree *kdTree_;
 		std::vector<Obstacle *> obstacles_;
 		float timeStep_;
+		ParallelFor parallelFor_;
 
 		friend class Agent;
 		friend class KdTree;
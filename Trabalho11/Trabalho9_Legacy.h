@@ -10,6 +10,13 @@
 #include <memory>
 #include <fstream>
 #include <chrono>
+#include "src/Core/Cell.h"
+#include "src/Core/ObstacleBitGrid.h"
+#include "src/Core/PathfindingAlgorithm.h"
+#include "src/Pathfinding/GridAStar.h"
+#include "src/Pathfinding/LandmarkTable.h"
+#include "src/Pathfinding/JumpPointSearch.h"
+#include "src/Pathfinding/BatchPathfinder.h"
 
 struct MetricData {
     int agentCount;
@@ -18,6 +25,8 @@ struct MetricData {
     double pathfindingTime;
     int pathLength;
     std::string distributionType;
+    std::string algorithm;
+    int expandedNodes;
 };
 
 class Metrics {
@@ -25,16 +34,18 @@ private:
     static std::vector<MetricData> data;
 public:
     static void RecordPathfinding(int agents, int gridW, int gridH, 
-                                double time, int pathLen, const std::string& dist) {
-        data.push_back({agents, gridW, gridH, time, pathLen, dist});
+                                double time, int pathLen, const std::string& dist,
+                                const std::string& algorithm = "AStar", int expanded = 0) {
+        data.push_back({agents, gridW, gridH, time, pathLen, dist, algorithm, expanded});
     }
     static void SaveToCSV(const std::string& filename) {
         std::ofstream file(filename);
-        file << "agents,grid_width,grid_height,time_ms,path_length,distribution\n";
+        file << "agents,grid_width,grid_height,time_ms,path_length,distribution,algorithm,expanded_nodes\n";
         for (const auto& metric : data) {
             file << metric.agentCount << "," << metric.gridWidth << ","
                  << metric.gridHeight << "," << metric.pathfindingTime * 1000 << ","
-                 << metric.pathLength << "," << metric.distributionType << "\n";
+                 << metric.pathLength << "," << metric.distributionType << ","
+                 << metric.algorithm << "," << metric.expandedNodes << "\n";
         }
         file.close();
     }
@@ -59,64 +70,65 @@ public:
     }
 };
 
+// Walkability vem do ObstacleBitGrid (1 bit por célula). Os Node só existem
+// para quem ainda pede Node* (IPathMovement): são criados no primeiro
+// GetNode e recebem walkable/occupied lidos dos bits a cada pedido.
 class Grid {
 private:
     int width, height;
     float cell_size;
-    std::vector<std::vector<Node>> nodes;
+    ObstacleBitGrid occupancy;
+    std::vector<Node> nodes;
 public:
-    Grid(int w, int h, float cell_size) : width(w), height(h), cell_size(cell_size) {
-        nodes.resize(height);
-        for (int y = 0; y < height; y++) {
-            nodes[y].resize(width);
-            for (int x = 0; x < width; x++) {
-                nodes[y][x] = Node(x, y); 
-            }
-        }
-    }
+    Grid(int w, int h, float cell_size) : width(w), height(h), cell_size(cell_size), occupancy(w, h) {}
     void Draw() {
         for (int y = 0; y < height; y++) {
             for (int x = 0; x < width; x++) {
-                Color color = nodes[y][x].occupied ? RED : BLACK;
-                if (!nodes[y][x].walkable) color = WHITE;
+                Color color = occupancy.isBlocked(x, y) ? WHITE : BLACK;
                 DrawRectangle(x * cell_size, y * cell_size, cell_size - 1, cell_size - 1, color);
                 DrawRectangleLines(x * cell_size, y * cell_size, cell_size, cell_size, DARKGRAY);
             }
         }
     }
     void SetOccupied(int x, int y, bool occupied) {
-        if (IsValidPosition(x, y)) {
-            nodes[y][x].occupied = occupied;
-            nodes[y][x].walkable = !occupied;
-        }
+        occupancy.set(x, y, occupied);
+    }
+    // Troca todos os bits de uma vez (mesmas dimensões); os tiles são compartilhados
+    void ReplaceOccupancy(const ObstacleBitGrid& source) {
+        occupancy = source;
     }
     void SetWalkable(int x, int y, bool walkable) {
-        if (IsValidPosition(x, y)) {
-            nodes[y][x].walkable = walkable;
-            nodes[y][x].occupied = !walkable;
-        }
+        occupancy.set(x, y, !walkable);
     }
     bool IsValidPosition(int x, int y) const {
         return x >= 0 && x < width && y >= 0 && y < height;
     }
     bool IsWalkable(int x, int y) const {
-        return IsValidPosition(x, y) && nodes[y][x].walkable;
+        return occupancy.isWalkable(x, y);
     }
     Node* GetNode(int x, int y) {
-        if (IsValidPosition(x, y)) {
-            return &nodes[y][x];
+        if (!IsValidPosition(x, y)) return nullptr;
+        if (nodes.empty()) {
+            nodes.reserve((size_t)width * height);
+            for (int ny = 0; ny < height; ny++) {
+                for (int nx = 0; nx < width; nx++) {
+                    nodes.emplace_back(nx, ny);
+                }
+            }
         }
-        return nullptr;
+        Node& node = nodes[(size_t)y * width + x];
+        node.walkable = !occupancy.isBlocked(x, y);
+        node.occupied = !node.walkable;
+        return &node;
     }
     void ResetPathfindingData() {
-        for (int y = 0; y < height; y++) {
-            for (int x = 0; x < width; x++) {
-                nodes[y][x].gCost = 0;
-                nodes[y][x].hCost = 0;
-                nodes[y][x].parent = nullptr;
-            }
+        for (auto& node : nodes) {
+            node.gCost = 0;
+            node.hCost = 0;
+            node.parent = nullptr;
         }
     }
+    const ObstacleBitGrid& GetOccupancy() const { return occupancy; }
     int GetWidth() const { return width; }
     int GetHeight() const { return height; }
     float GetCellSize() const { return cell_size; }
@@ -125,93 +137,124 @@ public:
 class Pathfinder {
 private:
     static double lastExecutionTime;
+    static int lastExpandedNodes;
     static float CalculateHeuristic(int x1, int y1, int x2, int y2) {
         return abs(x1 - x2) + abs(y1 - y2);
     }
-    static std::vector<Node*> GetNeighbors(Node* node, Grid& grid) {
-        std::vector<Node*> neighbors;
-        int directions[4][2] = {{0, 1}, {1, 0}, {0, -1}, {-1, 0}};
-        for (auto& dir : directions) {
-            int newX = node->x + dir[0];
-            int newY = node->y + dir[1];
-            if (grid.IsWalkable(newX, newY)) {
-                Node* neighbor = grid.GetNode(newX, newY);
-                if (neighbor) {
-                    neighbors.push_back(neighbor);
-                }
-            }
-        }
-        return neighbors;
+    // Tabela ALT só serve se foi construída para um grid retangular deste tamanho
+    static const LandmarkTable* LandmarksFor(Grid& grid, const LandmarkTable* table) {
+        if (!table || table->getGridType() != GridType::RECTANGULAR) return nullptr;
+        if (table->getWidth() != grid.GetWidth() || table->getHeight() != grid.GetHeight()) return nullptr;
+        return table;
+    }
+    // Motor A* com heap indexado e nós carimbados por geração (reaproveitado entre consultas)
+    static GridAStar& GetEngine() {
+        static GridAStar engine;
+        return engine;
     }
-    static std::vector<Vector2> ReconstructPath(Node* endNode) {
+    // Jump Point Search: poda caminhos simétricos em grids de custo uniforme
+    static JumpPointSearch& GetJPSEngine() {
+        static JumpPointSearch engine;
+        return engine;
+    }
+    // Lote de consultas agrupado por destino (busca reversa por grupo)
+    static BatchPathfinder& GetBatchEngine() {
+        static BatchPathfinder engine;
+        return engine;
+    }
+    // Mesmo lote, com as consultas isoladas respondidas pelo JPS
+    static JPSBatchPathfinder& GetJPSBatchEngine() {
+        static JPSBatchPathfinder engine;
+        return engine;
+    }
+    static std::vector<Vector2> ToWaypoints(const std::vector<Cell>& cells) {
         std::vector<Vector2> path;
-        Node* currentNode = endNode;
-        while (currentNode != nullptr) {
-            path.push_back({(float)currentNode->x, (float)currentNode->y});
-            currentNode = currentNode->parent;
+        path.reserve(cells.size());
+        for (const auto& cell : cells) {
+            path.push_back({(float)cell.x, (float)cell.y});
         }
-        std::reverse(path.begin(), path.end());
         return path;
     }
 public:
-    static std::vector<Vector2> FindPath(Grid& grid, Vector2 start, Vector2 end, const std::string& distribution = "random") {
+    // `landmarks`: heurística ALT da busca (nullptr = Manhattan)
+    static std::vector<Vector2> FindPath(Grid& grid, Vector2 start, Vector2 end, const std::string& distribution = "random",
+                                         PathfindingAlgorithm algorithm = PathfindingAlgorithm::ASTAR,
+                                         const LandmarkTable* landmarkTable = nullptr) {
         double startTime = GetTime();
-        grid.ResetPathfindingData();
-        Node* startNode = grid.GetNode((int)start.x, (int)start.y);
-        Node* endNode = grid.GetNode((int)end.x, (int)end.y);
-        if (!startNode || !endNode || !startNode->walkable || !endNode->walkable) {
+        Cell startCell = {(int)start.x, (int)start.y};
+        Cell endCell = {(int)end.x, (int)end.y};
+        lastExpandedNodes = 0;
+        if (!grid.IsWalkable(startCell.x, startCell.y) || !grid.IsWalkable(endCell.x, endCell.y)) {
             return {};
         }
-        std::vector<Node*> openSet;
-        std::vector<Node*> closedSet;
-        openSet.push_back(startNode);
-        while (!openSet.empty()) {
-            Node* currentNode = openSet[0];
-            int currentIndex = 0;
-            for (int i = 1; i < openSet.size(); i++) {
-                if (openSet[i]->fCost() < currentNode->fCost() || 
-                    (openSet[i]->fCost() == currentNode->fCost() && openSet[i]->hCost < currentNode->hCost)) {
-                    currentNode = openSet[i];
-                    currentIndex = i;
-                }
-            }
-            openSet.erase(openSet.begin() + currentIndex);
-            closedSet.push_back(currentNode);
-            if (currentNode == endNode) {
-                lastExecutionTime = GetTime() - startTime;
-                std::vector<Vector2> finalPath = ReconstructPath(currentNode);
-                Metrics::RecordPathfinding(1, grid.GetWidth(), grid.GetHeight(), 
-                                         lastExecutionTime, finalPath.size(), distribution);
-                return finalPath;
-            }
-            auto neighbors = GetNeighbors(currentNode, grid);
-            for (auto neighbor : neighbors) {
-                if (std::find(closedSet.begin(), closedSet.end(), neighbor) != closedSet.end()) {
-                    continue;
-                }
-                float newGCost = currentNode->gCost + 1;
-                if (newGCost < neighbor->gCost || 
-                    std::find(openSet.begin(), openSet.end(), neighbor) == openSet.end()) {
-                    neighbor->gCost = newGCost;
-                    neighbor->hCost = CalculateHeuristic(neighbor->x, neighbor->y, endNode->x, endNode->y);
-                    neighbor->parent = currentNode;
-                    if (std::find(openSet.begin(), openSet.end(), neighbor) == openSet.end()) {
-                        openSet.push_back(neighbor);
-                    }
-                }
-            }
+        auto isWalkable = [&grid](int x, int y) { return grid.IsWalkable(x, y); };
+        const LandmarkTable* landmarks = LandmarksFor(grid, landmarkTable);
+        auto heuristic = [landmarks](int x1, int y1, int x2, int y2) {
+            return landmarks ? landmarks->estimate(x1, y1, x2, y2) : CalculateHeuristic(x1, y1, x2, y2);
+        };
+        std::vector<Cell> cells;
+        bool found;
+        if (algorithm == PathfindingAlgorithm::JPS) {
+            found = GetJPSEngine().findPath(grid.GetWidth(), grid.GetHeight(), startCell, endCell,
+                                            isWalkable, heuristic, cells);
+            lastExpandedNodes = GetJPSEngine().getLastExpandedNodes();
+        } else {
+            found = GetEngine().findPath(grid.GetWidth(), grid.GetHeight(), startCell, endCell,
+                                         isWalkable, heuristic, cells);
+            lastExpandedNodes = GetEngine().getLastExpandedNodes();
         }
+        std::vector<Vector2> finalPath = found ? ToWaypoints(cells) : std::vector<Vector2>{};
         lastExecutionTime = GetTime() - startTime;
         Metrics::RecordPathfinding(1, grid.GetWidth(), grid.GetHeight(), 
-                                 lastExecutionTime, 0, distribution);
-        return {};
+                                 lastExecutionTime, finalPath.size(), distribution,
+                                 toString(algorithm), lastExpandedNodes);
+        return finalPath;
+    }
+    // Responde várias consultas de uma vez: consultas com o mesmo destino
+    // compartilham uma busca reversa; as isoladas usam `algorithm` (A* ou JPS).
+    // Os caminhos são ótimos (mesmo custo do A*), mas podem diferir do A* e
+    // do JPS entre caminhos empatados.
+    static std::vector<std::vector<Vector2>> FindPaths(Grid& grid, const std::vector<PathQuery>& queries,
+                                                       const std::string& distribution = "random",
+                                                       PathfindingAlgorithm algorithm = PathfindingAlgorithm::ASTAR,
+                                                       const LandmarkTable* landmarkTable = nullptr) {
+        double startTime = GetTime();
+        auto isWalkable = [&grid](int x, int y) { return grid.IsWalkable(x, y); };
+        const LandmarkTable* landmarks = LandmarksFor(grid, landmarkTable);
+        auto heuristic = [landmarks](int x1, int y1, int x2, int y2) {
+            return landmarks ? landmarks->estimate(x1, y1, x2, y2) : CalculateHeuristic(x1, y1, x2, y2);
+        };
+        std::vector<std::vector<Cell>> cells;
+        if (algorithm == PathfindingAlgorithm::JPS) {
+            GetJPSBatchEngine().findPaths(grid.GetWidth(), grid.GetHeight(), queries, isWalkable, heuristic, cells);
+            lastExpandedNodes = GetJPSBatchEngine().getLastExpandedNodes();
+        } else {
+            GetBatchEngine().findPaths(grid.GetWidth(), grid.GetHeight(), queries, isWalkable, heuristic, cells);
+            lastExpandedNodes = GetBatchEngine().getLastExpandedNodes();
+        }
+        std::vector<std::vector<Vector2>> paths;
+        paths.reserve(cells.size());
+        size_t totalLength = 0;
+        for (const auto& path : cells) {
+            paths.push_back(ToWaypoints(path));
+            totalLength += path.size();
+        }
+        lastExecutionTime = GetTime() - startTime;
+        Metrics::RecordPathfinding((int)queries.size(), grid.GetWidth(), grid.GetHeight(),
+                                 lastExecutionTime, (int)totalLength, distribution,
+                                 toString(algorithm), lastExpandedNodes);
+        return paths;
     }
     static double GetLastExecutionTime() {
         return lastExecutionTime;
     }
+    static int GetLastExpandedNodes() {
+        return lastExpandedNodes;
+    }
 };
 
 inline double Pathfinder::lastExecutionTime = 0.0;
+inline int Pathfinder::lastExpandedNodes = 0;
 
 class Agent {
 private:
@@ -225,9 +268,9 @@ private:
 public:
     Agent(Vector2 start, Vector2 target) : position(start), target(target), has_path(false), 
                                           color(GetRandomColor()), speed(2.0f), currentPathIndex(0) {}
-    void Update(Grid& grid, float delta_time) {
+    void Update(Grid& grid, float delta_time, PathfindingAlgorithm algorithm = PathfindingAlgorithm::ASTAR) {
         if (!has_path) {
-            FindPath(grid);
+            FindPath(grid, algorithm);
             return;
         }
         if (currentPathIndex < path.size()) {
@@ -251,9 +294,9 @@ public:
     void Draw(Grid& grid) {
         DrawCircle(position.x, position.y, grid.GetCellSize() / 3, color);
     }
-    void FindPath(Grid& grid) {
+    void FindPath(Grid& grid, PathfindingAlgorithm algorithm = PathfindingAlgorithm::ASTAR) {
         Vector2 gridStart = {position.x / grid.GetCellSize(), position.y / grid.GetCellSize()};
-        path = Pathfinder::FindPath(grid, gridStart, target, "random");
+        path = Pathfinder::FindPath(grid, gridStart, target, "random", algorithm);
         has_path = !path.empty();
         currentPathIndex = 0;
     }
@@ -269,8 +312,11 @@ class AgentManager {
 private:
     std::vector<Agent> agents;
     Grid* grid;
+    PathfindingAlgorithm algorithm = PathfindingAlgorithm::ASTAR;
 public:
     AgentManager(Grid* grid) : grid(grid) {}
+    void SetAlgorithm(PathfindingAlgorithm a) { algorithm = a; }
+    PathfindingAlgorithm GetAlgorithm() const { return algorithm; }
     void AddAgent(Vector2 start, Vector2 target) {
         Vector2 worldStart = {start.x * grid->GetCellSize() + grid->GetCellSize() / 2, 
                              start.y * grid->GetCellSize() + grid->GetCellSize() / 2};
@@ -293,7 +339,7 @@ public:
     }
     void UpdateAll(float delta_time) {
         for (auto& agent : agents) {
-            agent.Update(*grid, delta_time);
+            agent.Update(*grid, delta_time, algorithm);
         }
     }
     void DrawAll(Grid& grid) {
@@ -306,8 +352,8 @@ public:
     
 };
 
-inline void RunPerformanceTests() {
-    printf("Iniciando testes de performance...\n");
+inline void RunPerformanceTests(PathfindingAlgorithm algorithm = PathfindingAlgorithm::ASTAR) {
+    printf("Iniciando testes de performance (%s)...\n", toString(algorithm));
     std::vector<std::pair<int, int>> gridSizes = {{10, 10}, {20, 20}, {40, 40}};
     std::vector<int> agentCounts = {1, 5, 10, 20};
     for (auto& gridSize : gridSizes) {
@@ -317,6 +363,7 @@ inline void RunPerformanceTests() {
         Grid grid(width, height, cellSize);
         for (int agents : agentCounts) {
             AgentManager manager(&grid);
+            manager.SetAlgorithm(algorithm);
             for (int i = 0; i < (width * height) / 8; i++) {
                 int x = GetRandomValue(0, width-1);
                 int y = GetRandomValue(0, height-1);
@@ -0,0 +1,196 @@
+// Bateria de simulações sem janela: roda o SimulationBenchmark direto pela
+// linha de comando, na velocidade que a CPU permitir (servidores sem tela,
+// varreduras noturnas). Nada é desenhado e nenhuma janela é aberta.
+#include "src/GridManager.h"
+#include "src/Factories/AppFactory.h"
+#include "src/Observer/GameAgentManager.h"
+#include "src/Collision/SimulationBenchmark.h"
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <cstdlib>
+
+namespace {
+
+struct Options {
+    GridType gridType = GridType::RECTANGULAR;
+    int cols = 0;                 // 0 = mesmas dimensões da janela do jogo
+    int rows = 0;
+    std::string mapPath;
+    std::vector<int> agentCounts = {5, 10, 15, 20, 30};
+    std::vector<std::string> methods = SimulationBenchmark::availableMethods();
+    PathfindingAlgorithm algorithm = PathfindingAlgorithm::ASTAR;
+    int frames = 3600;
+    float timeout = 60.0f;
+    bool seeded = false;
+    unsigned int seed = 0;
+    int threads = 0;
+    std::string output = "resultados_simulacao.csv";
+    int scalingAgents = 0;
+};
+
+void printUsage() {
+    std::cout <<
+        "uso: sim_batch [opcoes]\n"
+        "  --grid rect|hex         tipo de grid (rect)\n"
+        "  --size COLSxLINHAS      dimensoes em celulas (as da janela do jogo)\n"
+        "  --map ARQUIVO           grid de um mapa salvo (F5); ignora --grid/--size\n"
+        "  --agents 5,10,30        quantidades de agentes por teste\n"
+        "  --methods Direta,Indireta,Sem_Comunicacao\n"
+        "  --algorithm astar|jps   busca no grid retangular (astar)\n"
+        "  --frames N              maximo de frames por teste (3600)\n"
+        "  --timeout S             segundos de parede por teste (60)\n"
+        "  --seed N                semente: cada teste sorteia a mesma populacao\n"
+        "  --threads N             threads da atualizacao (0 = uma por nucleo)\n"
+        "  --output ARQUIVO.csv    resultados (resultados_simulacao.csv)\n"
+        "  --scaling N             mede o ganho por threads com N agentes (0 = nao)\n";
+}
+
+std::vector<std::string> split(const std::string& text, char separator) {
+    std::vector<std::string> parts;
+    std::stringstream stream(text);
+    std::string part;
+    while (std::getline(stream, part, separator)) {
+        if (!part.empty()) parts.push_back(part);
+    }
+    return parts;
+}
+
+bool parseInt(const std::string& text, int& value) {
+    char* end = nullptr;
+    long parsed = std::strtol(text.c_str(), &end, 10);
+    if (text.empty() || *end != '\0') return false;
+    value = (int)parsed;
+    return true;
+}
+
+bool parseOptions(int argc, char** argv, Options& options) {
+    for (int i = 1; i < argc; ++i) {
+        std::string name = argv[i];
+        if (i + 1 >= argc) {
+            std::cerr << "[sim_batch] Falta o valor de " << name << std::endl;
+            return false;
+        }
+        std::string value = argv[++i];
+        int number = 0;
+        bool ok = true;
+
+        if (name == "--grid") {
+            ok = value == "rect" || value == "hex";
+            options.gridType = value == "hex" ? GridType::HEXAGONAL : GridType::RECTANGULAR;
+        } else if (name == "--size") {
+            auto parts = split(value, 'x');
+            ok = parts.size() == 2 && parseInt(parts[0], options.cols) && parseInt(parts[1], options.rows) &&
+                 options.cols > 0 && options.rows > 0;
+        } else if (name == "--map") {
+            options.mapPath = value;
+        } else if (name == "--agents") {
+            options.agentCounts.clear();
+            for (const auto& part : split(value, ',')) {
+                ok = ok && parseInt(part, number) && number > 0;
+                options.agentCounts.push_back(number);
+            }
+            ok = ok && !options.agentCounts.empty();
+        } else if (name == "--methods") {
+            options.methods = split(value, ',');
+            auto known = SimulationBenchmark::availableMethods();
+            for (const auto& method : options.methods) {
+                ok = ok && std::find(known.begin(), known.end(), method) != known.end();
+            }
+            ok = ok && !options.methods.empty();
+        } else if (name == "--algorithm") {
+            ok = value == "astar" || value == "jps";
+            options.algorithm = value == "jps" ? PathfindingAlgorithm::JPS : PathfindingAlgorithm::ASTAR;
+        } else if (name == "--frames") {
+            ok = parseInt(value, options.frames) && options.frames > 0;
+        } else if (name == "--timeout") {
+            ok = parseInt(value, number) && number > 0;
+            options.timeout = (float)number;
+        } else if (name == "--seed") {
+            ok = parseInt(value, number);
+            options.seed = (unsigned int)number;
+            options.seeded = true;
+        } else if (name == "--threads") {
+            ok = parseInt(value, options.threads) && options.threads >= 0;
+        } else if (name == "--output") {
+            options.output = value;
+        } else if (name == "--scaling") {
+            ok = parseInt(value, options.scalingAgents) && options.scalingAgents >= 0;
+        } else {
+            std::cerr << "[sim_batch] Opcao desconhecida: " << name << std::endl;
+            return false;
+        }
+
+        if (!ok) {
+            std::cerr << "[sim_batch] Valor invalido para " << name << ": " << value << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--help" || arg == "-h") {
+            printUsage();
+            return 0;
+        }
+    }
+
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        printUsage();
+        return 2;
+    }
+
+    // Grid: do arquivo ou do tamanho pedido (sem janela, direto no GridManager)
+    MapFile map;
+    auto* gridManager = GridManager::getInstance();
+    if (!options.mapPath.empty()) {
+        std::string error;
+        if (!map.open(options.mapPath, &error)) {
+            std::cerr << "[sim_batch] Falha ao carregar " << options.mapPath << ": " << error << std::endl;
+            return 1;
+        }
+        gridManager->init(std::make_unique<StandardAStarAppFactory>(), map.getGridType(),
+                          map.getWidth(), map.getHeight());
+        if (!gridManager->loadGrid(map)) {
+            std::cerr << "[sim_batch] Arquivo corrompido: " << options.mapPath << std::endl;
+            return 1;
+        }
+        options.gridType = map.getGridType();
+    } else {
+        if (options.cols == 0) {
+            GridManager::gridSizeFor(options.gridType, 800.0f, 600.0f, options.cols, options.rows);
+        }
+        gridManager->init(std::make_unique<StandardAStarAppFactory>(), options.gridType,
+                          options.cols, options.rows);
+    }
+    IGridAdapter* gridAdapter = gridManager->getGrid();
+    if (!gridAdapter) {
+        std::cerr << "[sim_batch] Nao foi possivel criar o grid" << std::endl;
+        return 1;
+    }
+
+    auto agentManager = std::make_unique<GameAgentManager>(
+        gridAdapter, options.gridType, options.mapPath.empty() ? nullptr : &map);
+    agentManager->setWorkerThreads(options.threads);
+
+    SimulationBenchmark benchmark(agentManager.get(), gridAdapter, options.gridType);
+    benchmark.setAgentCounts(options.agentCounts);
+    benchmark.setMethods(options.methods);
+    benchmark.setPathfindingAlgorithm(options.algorithm);
+    benchmark.setMaxFrames(options.frames);
+    benchmark.setTimeoutSeconds(options.timeout);
+    benchmark.setOutputPath(options.output);
+    benchmark.setThreadScalingAgents(options.scalingAgents);
+    if (options.seeded) benchmark.setSeed(options.seed);
+    benchmark.runFullBenchmark();
+    return 0;
+}
@@ -6,14 +6,23 @@
 
 class AStarAdapter : public IAlgorithm {
 public:
-    std::vector<Vector2> FindPath(IGrid* grid, Vector2 start, Vector2 end) override {
+    std::vector<Vector2> FindPath(IGrid* grid, Vector2 start, Vector2 end,
+                                  const LandmarkTable* landmarks = nullptr) override {
         Grid& legacyGrid = grid->GetLegacyGrid();
-        return Pathfinder::FindPath(legacyGrid, start, end, "AStar_Adapter");
+        return Pathfinder::FindPath(legacyGrid, start, end, "AStar_Adapter", PathfindingAlgorithm::ASTAR, landmarks);
     }
 
     double GetLastExecutionTime() const override {
         return Pathfinder::GetLastExecutionTime();
     }
+
+    int GetLastExpandedNodes() const override {
+        return Pathfinder::GetLastExpandedNodes();
+    }
+
+    std::string GetName() const override {
+        return toString(PathfindingAlgorithm::ASTAR);
+    }
 };
 
 #endif // ASTAR_ADAPTER_H
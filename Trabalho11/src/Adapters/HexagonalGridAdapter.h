@@ -3,23 +3,32 @@
 
 #include "../../src/Interfaces/IGridAdapter.h"
 #include "../../src/Core/Cell.h"
+#include "../../src/Pathfinding/HexAStar.h"
+#include "../../src/Pathfinding/BatchPathfinder.h"
+#include "../../src/Pathfinding/LandmarkTable.h"
 #include "raylib.h"
 #include <vector>
 #include <list>
 #include <cmath>
-#include <queue>
-#include <unordered_map>
 #include <algorithm>
 
 // Grid Hexagonal usando coordenadas offset (odd-q)
 // Layout "pointy-top" com colunas ímpares deslocadas para baixo
 class HexagonalGridAdapter : public IGridAdapter {
+public:
+    // Acima disso (câmera afastada) só os obstáculos são desenhados
+    static constexpr long long MAX_OUTLINED_CELLS = 20000;
+
 private:
     int width;   // número de colunas
     int height;  // número de linhas
     float hexRadius = 12.0f;  // raio do hexágono (distância do centro ao vértice)
-    std::vector<std::vector<bool>> obstacles;
-    Grid legacyGrid; // For compatibility with the old system
+    Grid legacyGrid; // Dono dos bits de obstáculo (ObstacleBitGrid) do mapa
+    const ObstacleBitGrid& occupancy;
+    GridChangeJournal journal;
+    HexAStar searchEngine;          // Nós e heap reaproveitados entre consultas
+    HexBatchPathfinder batchEngine; // Lotes de consultas agrupados por destino
+    std::vector<Cell> cellPath;
 
     // Dimensões derivadas do hexágono (pointy-top)
     float hexWidth() const { return std::sqrt(3.0f) * hexRadius; }
@@ -30,9 +39,10 @@ private:
 public:
     HexagonalGridAdapter(int w, int h) 
         : width(w), height(h), 
-          legacyGrid(w, h, hexRadius * 2) {
-        obstacles.resize(width, std::vector<bool>(height, false));
-    }
+          legacyGrid(w, h, hexRadius * 2), occupancy(legacyGrid.GetOccupancy()) {}
+
+    HexagonalGridAdapter(const HexagonalGridAdapter&) = delete;
+    HexagonalGridAdapter& operator=(const HexagonalGridAdapter&) = delete;
 
     // Converte coordenadas do grid para posição em pixels (centro do hexágono)
     Vector2 hexToPixel(int col, int row) const {
@@ -94,28 +104,63 @@ public:
     }
 
     void Draw() override {
-        for (int col = 0; col < width; col++) {
-            for (int row = 0; row < height; row++) {
-                Vector2 center = hexToPixel(col, row);
-                
-                if (obstacles[col][row]) {
-                    DrawHexagon(center, BLACK, DARKGRAY, true);
-                } else {
-                    DrawHexagon(center, RAYWHITE, LIGHTGRAY, false);
+        Vector2 world = getWorldSize();
+        DrawArea({0.0f, 0.0f, world.x, world.y});
+    }
+
+    // Só as colunas/linhas que cruzam a área (com um hexágono de margem). Com
+    // a câmera afastada só os obstáculos são desenhados e tiles uniformes
+    // livres do ObstacleBitGrid são pulados inteiros
+    void DrawArea(Rectangle area) override {
+        int col0 = std::max(0, (int)std::floor((area.x - hexWidth()) / horizSpacing()));
+        int row0 = std::max(0, (int)std::floor((area.y - hexHeight()) / vertSpacing()));
+        int col1 = std::min(width - 1, (int)std::ceil((area.x + area.width) / horizSpacing()));
+        int row1 = std::min(height - 1, (int)std::ceil((area.y + area.height) / vertSpacing()));
+        if (col0 > col1 || row0 > row1) return;
+        bool outlines = (long long)(col1 - col0 + 1) * (row1 - row0 + 1) <= MAX_OUTLINED_CELLS;
+
+        const int shift = ObstacleBitGrid::TILE_SHIFT;
+        const int last = ObstacleBitGrid::TILE_SIZE - 1;
+        for (int ty = row0 >> shift; ty <= row1 >> shift; ty++) {
+            for (int tx = col0 >> shift; tx <= col1 >> shift; tx++) {
+                bool blocked;
+                if (!outlines && occupancy.isUniformTile(tx, ty, blocked) && !blocked) continue;
+                int c0 = std::max(col0, tx << shift), c1 = std::min(col1, (tx << shift) + last);
+                int r0 = std::max(row0, ty << shift), r1 = std::min(row1, (ty << shift) + last);
+                for (int col = c0; col <= c1; col++) {
+                    for (int row = r0; row <= r1; row++) {
+                        Vector2 center = hexToPixel(col, row);
+                        if (occupancy.isBlocked(col, row)) {
+                            DrawHexagon(center, BLACK, DARKGRAY, true);
+                        } else if (outlines) {
+                            DrawHexagon(center, RAYWHITE, LIGHTGRAY, false);
+                        }
+                    }
                 }
             }
         }
     }
+
+    Vector2 getWorldSize() const override {
+        return {(width - 1) * horizSpacing() + hexWidth(),
+                (height - 1) * vertSpacing() + vertSpacing() / 2.0f + hexHeight()};
+    }
     
     void SetObstacle(int x, int y, bool isObstacle) override {
-        if (isValidCoordinate(x, y)) {
-            obstacles[x][y] = isObstacle;
-            legacyGrid.SetOccupied(x, y, isObstacle);
-        }
+        if (!occupancy.inBounds(x, y) || occupancy.isBlocked(x, y) == isObstacle) return;
+        legacyGrid.SetOccupied(x, y, isObstacle);
+        journal.record(x, y, isObstacle);
+    }
+
+    bool replaceOccupancy(const ObstacleBitGrid& source) override {
+        if (source.getWidth() != width || source.getHeight() != height) return false;
+        legacyGrid.ReplaceOccupancy(source);
+        journal.recordArea({0, 0, width - 1, height - 1}, true);
+        return true;
     }
     
     bool IsWalkable(int x, int y) const override {
-        return isValidCoordinate(x, y) && !obstacles[x][y];
+        return occupancy.isWalkable(x, y);
     }
     
     int GetWidth() const override { return width; }
@@ -130,50 +175,20 @@ public:
         std::vector<Node*> neighbors;
         if (!node) return neighbors;
         
-        auto cellNeighbors = getNeighbors({node->x, node->y});
-        for (const auto& cell : cellNeighbors) {
-            Node* n = legacyGrid.GetNode(cell.x, cell.y);
-            if (n && IsWalkable(cell.x, cell.y)) {
-                neighbors.push_back(n);
-            }
-        }
+        GridTopology::forEachNeighbor<GridTopology::HexOddQ>(node->x, node->y, width, height,
+            [&](int x, int y) {
+                Node* n = legacyGrid.GetNode(x, y);
+                if (n && IsWalkable(x, y)) neighbors.push_back(n);
+            });
         return neighbors;
     }
 
-    // Vizinhos em grid hexagonal (offset odd-q, pointy-top)
+    // Vizinhos em grid hexagonal (offset odd-q, pointy-top). Fachada para a
+    // UI; as buscas iteram GridTopology::HexOddQ diretamente
     std::list<Cell> getNeighbors(Cell cell) const override {
         std::list<Cell> neighbors;
-        
-        // Direções para odd-q offset (pointy-top)
-        // Vizinhos para coluna par
-        static const int evenColDirs[6][2] = {
-            {0, -1},   // Norte
-            {1, -1},   // Nordeste
-            {1, 0},    // Sudeste
-            {0, 1},    // Sul
-            {-1, 0},   // Sudoeste
-            {-1, -1}   // Noroeste
-        };
-        
-        // Vizinhos para coluna ímpar
-        static const int oddColDirs[6][2] = {
-            {0, -1},   // Norte
-            {1, 0},    // Nordeste
-            {1, 1},    // Sudeste
-            {0, 1},    // Sul
-            {-1, 1},   // Sudoeste
-            {-1, 0}    // Noroeste
-        };
-        
-        const int (*dirs)[2] = (cell.x % 2 == 0) ? evenColDirs : oddColDirs;
-
-        for (int i = 0; i < 6; ++i) {
-            int newX = cell.x + dirs[i][0];
-            int newY = cell.y + dirs[i][1];
-            if (isValidCoordinate(newX, newY)) {
-                neighbors.push_back({newX, newY});
-            }
-        }
+        GridTopology::forEachNeighbor<GridTopology::HexOddQ>(cell.x, cell.y, width, height,
+            [&neighbors](int x, int y) { neighbors.push_back({x, y}); });
         return neighbors;
     }
 
@@ -184,104 +199,61 @@ public:
     Cell getCell(int x, int y) const override {
         return {x, y};
     }
+
+    const ObstacleBitGrid& getOccupancy() const override { return occupancy; }
+    GridChangeJournal& getJournal() override { return journal; }
+    const GridChangeJournal& getJournal() const override { return journal; }
     
     Cell getClickedCell(Vector2 mousePos) const {
         return pixelToHex(mousePos.x, mousePos.y);
     }
 
-    // A* Pathfinding específico para grid hexagonal
-    std::vector<Vector2> FindPathHex(Vector2 start, Vector2 end) {
+    // A* Pathfinding específico para grid hexagonal (motor HexAStar).
+    // Com `landmarks`, usa a heurística ALT no lugar da distância hexagonal.
+    std::vector<Vector2> FindPathHex(Vector2 start, Vector2 end, const LandmarkTable* landmarks = nullptr) {
         Cell startCell = {(int)start.x, (int)start.y};
         Cell endCell = {(int)end.x, (int)end.y};
-        
-        if (!IsWalkable(startCell.x, startCell.y) || !IsWalkable(endCell.x, endCell.y)) {
-            return {};
+
+        auto walkable = [this](int x, int y) { return !occupancy.isBlocked(x, y); };
+        std::vector<Vector2> path;
+        bool found = landmarks ?
+            searchEngine.findPath(width, height, startCell, endCell, walkable, *landmarks, cellPath) :
+            searchEngine.findPath(width, height, startCell, endCell, walkable, cellPath);
+        if (!found) return path;
+        path.reserve(cellPath.size());
+        for (const Cell& cell : cellPath) {
+            path.push_back({(float)cell.x, (float)cell.y});
         }
-        
-        // Estrutura para nós do A*
-        struct AStarNode {
-            Cell cell;
-            float gCost;
-            float hCost;
-            float fCost() const { return gCost + hCost; }
-            Cell parent;
-            bool hasParent;
-        };
-        
-        auto cellHash = [](const Cell& c) { return std::hash<int>()(c.x) ^ (std::hash<int>()(c.y) << 16); };
-        auto cellEqual = [](const Cell& a, const Cell& b) { return a.x == b.x && a.y == b.y; };
-        
-        std::unordered_map<Cell, AStarNode, decltype(cellHash), decltype(cellEqual)> 
-            allNodes(10, cellHash, cellEqual);
-        
-        auto heuristic = [](Cell a, Cell b) -> float {
-            // Distância de Manhattan adaptada para hex
-            int dx = std::abs(a.x - b.x);
-            int dy = std::abs(a.y - b.y);
-            return (float)(dx + std::max(0, dy - dx / 2));
-        };
-        
-        auto cmp = [&allNodes](const Cell& a, const Cell& b) {
-            return allNodes[a].fCost() > allNodes[b].fCost();
-        };
-        
-        std::priority_queue<Cell, std::vector<Cell>, decltype(cmp)> openSet(cmp);
-        std::unordered_map<Cell, bool, decltype(cellHash), decltype(cellEqual)> 
-            closedSet(10, cellHash, cellEqual);
-        std::unordered_map<Cell, bool, decltype(cellHash), decltype(cellEqual)> 
-            inOpenSet(10, cellHash, cellEqual);
-        
-        // Inicializa o nó inicial
-        allNodes[startCell] = {startCell, 0, heuristic(startCell, endCell), {0, 0}, false};
-        openSet.push(startCell);
-        inOpenSet[startCell] = true;
-        
-        while (!openSet.empty()) {
-            Cell current = openSet.top();
-            openSet.pop();
-            inOpenSet[current] = false;
-            
-            if (current == endCell) {
-                // Reconstrói o caminho
-                std::vector<Vector2> path;
-                Cell node = endCell;
-                while (!(node == startCell)) {
-                    path.push_back({(float)node.x, (float)node.y});
-                    if (!allNodes[node].hasParent) break;
-                    node = allNodes[node].parent;
-                }
-                path.push_back({(float)startCell.x, (float)startCell.y});
-                std::reverse(path.begin(), path.end());
-                return path;
-            }
-            
-            closedSet[current] = true;
-            
-            for (const Cell& neighbor : getNeighbors(current)) {
-                if (closedSet[neighbor] || !IsWalkable(neighbor.x, neighbor.y)) {
-                    continue;
-                }
-                
-                float tentativeG = allNodes[current].gCost + 1.0f;
-                
-                if (allNodes.find(neighbor) == allNodes.end()) {
-                    allNodes[neighbor] = {neighbor, tentativeG, heuristic(neighbor, endCell), current, true};
-                    openSet.push(neighbor);
-                    inOpenSet[neighbor] = true;
-                } else if (tentativeG < allNodes[neighbor].gCost) {
-                    allNodes[neighbor].gCost = tentativeG;
-                    allNodes[neighbor].parent = current;
-                    allNodes[neighbor].hasParent = true;
-                    if (!inOpenSet[neighbor]) {
-                        openSet.push(neighbor);
-                        inOpenSet[neighbor] = true;
-                    }
-                }
+        return path;
+    }
+
+    // Versão em lote de FindPathHex: consultas com o mesmo destino compartilham
+    // uma busca reversa, as isoladas usam A* comum
+    std::vector<std::vector<Vector2>> FindPathsHex(const std::vector<PathQuery>& queries,
+                                                   const LandmarkTable* landmarks = nullptr) {
+        auto walkable = [this](int x, int y) { return !occupancy.isBlocked(x, y); };
+        std::vector<std::vector<Cell>> cellPaths;
+        if (landmarks) {
+            batchEngine.findPaths(width, height, queries, walkable, *landmarks, cellPaths);
+        } else {
+            batchEngine.findPaths(width, height, queries, walkable,
+                                  GridTopology::HexOddQ::heuristic, cellPaths);
+        }
+
+        std::vector<std::vector<Vector2>> paths(cellPaths.size());
+        for (size_t i = 0; i < cellPaths.size(); ++i) {
+            paths[i].reserve(cellPaths[i].size());
+            for (const Cell& cell : cellPaths[i]) {
+                paths[i].push_back({(float)cell.x, (float)cell.y});
             }
         }
-        
-        return {}; // Caminho não encontrado
+        return paths;
     }
+
+    // Nós expandidos pela última chamada de FindPathHex
+    int GetLastExpandedNodes() const { return searchEngine.getLastExpandedNodes(); }
+    // Nós expandidos pelo último lote de FindPathsHex
+    int GetLastBatchExpandedNodes() const { return batchEngine.getLastExpandedNodes(); }
 };
 
 #endif // HEXAGONAL_GRID_ADAPTER_H
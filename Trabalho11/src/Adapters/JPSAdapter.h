@@ -0,0 +1,31 @@
+#ifndef JPS_ADAPTER_H
+#define JPS_ADAPTER_H
+
+#include "src/Interfaces/IAlgorithm.h"
+#include "../../Trabalho9_Legacy.h"
+
+// Segunda implementação de IAlgorithm: Jump Point Search sobre o mesmo Grid
+// legado usado pelo AStarAdapter. Retorna o mesmo formato de waypoints
+// (uma célula por passo), então pode substituir o A* sem mudar os consumidores.
+class JPSAdapter : public IAlgorithm {
+public:
+    std::vector<Vector2> FindPath(IGrid* grid, Vector2 start, Vector2 end,
+                                  const LandmarkTable* landmarks = nullptr) override {
+        Grid& legacyGrid = grid->GetLegacyGrid();
+        return Pathfinder::FindPath(legacyGrid, start, end, "JPS_Adapter", PathfindingAlgorithm::JPS, landmarks);
+    }
+
+    double GetLastExecutionTime() const override {
+        return Pathfinder::GetLastExecutionTime();
+    }
+
+    int GetLastExpandedNodes() const override {
+        return Pathfinder::GetLastExpandedNodes();
+    }
+
+    std::string GetName() const override {
+        return toString(PathfindingAlgorithm::JPS);
+    }
+};
+
+#endif // JPS_ADAPTER_H
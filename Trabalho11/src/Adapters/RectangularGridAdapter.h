@@ -3,44 +3,97 @@
 
 #include "../../src/Interfaces/IGridAdapter.h"
 #include "../../src/Core/Cell.h"
+#include "../../src/Pathfinding/GridTopology.h"
 #include "raylib.h"
 #include <vector>
 #include <list>
+#include <algorithm>
+#include <cmath>
 
 class RectangularGridAdapter : public IGridAdapter {
+public:
+    // Acima disso (câmera afastada) só as paredes são desenhadas
+    static constexpr long long MAX_OUTLINED_CELLS = 20000;
+
 private:
     int width;
     int height;
     float cellSize = 20.0f;
-    std::vector<std::vector<bool>> obstacles;
-    Grid legacyGrid; // For compatibility with the old system
+    Grid legacyGrid; // Dono dos bits de obstáculo (ObstacleBitGrid) do mapa
+    const ObstacleBitGrid& occupancy;
+    GridChangeJournal journal;
 
 public:
-    RectangularGridAdapter(int width, int height) : width(width), height(height), legacyGrid(width, height, cellSize) {
-        obstacles.resize(width, std::vector<bool>(height, false));
-    }
+    RectangularGridAdapter(int width, int height)
+        : width(width), height(height), legacyGrid(width, height, cellSize),
+          occupancy(legacyGrid.GetOccupancy()) {}
+
+    RectangularGridAdapter(const RectangularGridAdapter&) = delete;
+    RectangularGridAdapter& operator=(const RectangularGridAdapter&) = delete;
 
     void Draw() override {
-        for (int i = 0; i < width; i++) {
-            for (int j = 0; j < height; j++) {
-                if (obstacles[i][j]) {
-                    DrawRectangle(i * cellSize, j * cellSize, cellSize, cellSize, BLACK);
-                } else {
-                    DrawRectangleLines(i * cellSize, j * cellSize, cellSize, cellSize, LIGHTGRAY);
+        Vector2 world = getWorldSize();
+        DrawArea({0.0f, 0.0f, world.x, world.y});
+    }
+
+    // Percorre os tiles do ObstacleBitGrid que cruzam a área: tile uniforme
+    // bloqueado vira um único retângulo; com a câmera afastada (muitas células
+    // na área) as linhas das células livres são omitidas e tiles livres nem
+    // são visitados
+    void DrawArea(Rectangle area) override {
+        int x0 = std::max(0, (int)std::floor(area.x / cellSize));
+        int y0 = std::max(0, (int)std::floor(area.y / cellSize));
+        int x1 = std::min(width - 1, (int)std::floor((area.x + area.width) / cellSize));
+        int y1 = std::min(height - 1, (int)std::floor((area.y + area.height) / cellSize));
+        if (x0 > x1 || y0 > y1) return;
+        bool outlines = (long long)(x1 - x0 + 1) * (y1 - y0 + 1) <= MAX_OUTLINED_CELLS;
+
+        const int shift = ObstacleBitGrid::TILE_SHIFT;
+        const int last = ObstacleBitGrid::TILE_SIZE - 1;
+        for (int ty = y0 >> shift; ty <= y1 >> shift; ty++) {
+            for (int tx = x0 >> shift; tx <= x1 >> shift; tx++) {
+                int cx0 = std::max(x0, tx << shift), cx1 = std::min(x1, (tx << shift) + last);
+                int cy0 = std::max(y0, ty << shift), cy1 = std::min(y1, (ty << shift) + last);
+                bool blocked;
+                if (occupancy.isUniformTile(tx, ty, blocked) && (blocked || !outlines)) {
+                    if (blocked) {
+                        DrawRectangle(cx0 * cellSize, cy0 * cellSize, (cx1 - cx0 + 1) * cellSize,
+                                      (cy1 - cy0 + 1) * cellSize, BLACK);
+                    }
+                    continue;
+                }
+                for (int j = cy0; j <= cy1; j++) {
+                    for (int i = cx0; i <= cx1; i++) {
+                        if (occupancy.isBlocked(i, j)) {
+                            DrawRectangle(i * cellSize, j * cellSize, cellSize, cellSize, BLACK);
+                        } else if (outlines) {
+                            DrawRectangleLines(i * cellSize, j * cellSize, cellSize, cellSize, LIGHTGRAY);
+                        }
+                    }
                 }
             }
         }
     }
 
+    Vector2 getWorldSize() const override {
+        return {width * cellSize, height * cellSize};
+    }
+
     void SetObstacle(int x, int y, bool isObstacle) override {
-        if (isValidCoordinate(x, y)) {
-            obstacles[x][y] = isObstacle;
-            legacyGrid.SetOccupied(x, y, isObstacle);
-        }
+        if (!occupancy.inBounds(x, y) || occupancy.isBlocked(x, y) == isObstacle) return;
+        legacyGrid.SetOccupied(x, y, isObstacle);
+        journal.record(x, y, isObstacle);
+    }
+
+    bool replaceOccupancy(const ObstacleBitGrid& source) override {
+        if (source.getWidth() != width || source.getHeight() != height) return false;
+        legacyGrid.ReplaceOccupancy(source);
+        journal.recordArea({0, 0, width - 1, height - 1}, true);
+        return true;
     }
 
     bool IsWalkable(int x, int y) const override {
-        return isValidCoordinate(x, y) && !obstacles[x][y];
+        return occupancy.isWalkable(x, y);
     }
 
     int GetWidth() const override { return width; }
@@ -49,20 +102,22 @@ public:
     Grid& GetLegacyGrid() override { return legacyGrid; }
 
     void SetPathMovementStrategy(std::unique_ptr<IPathMovement> strategy) override { /* Dummy implementation */ }
-    std::vector<Node*> GetNeighbors(Node* node) override { return {}; /* Dummy implementation */ }
+    std::vector<Node*> GetNeighbors(Node* node) override {
+        std::vector<Node*> neighbors;
+        if (!node) return neighbors;
+        GridTopology::forEachNeighbor<GridTopology::Rect4>(node->x, node->y, width, height,
+            [&](int x, int y) {
+                Node* n = legacyGrid.GetNode(x, y);
+                if (n && IsWalkable(x, y)) neighbors.push_back(n);
+            });
+        return neighbors;
+    }
 
+    // Fachada para a UI; as buscas iteram GridTopology::Rect4 diretamente
     std::list<Cell> getNeighbors(Cell cell) const override {
         std::list<Cell> neighbors;
-        int dx[] = {-1, 1, 0, 0}; // Left, Right
-        int dy[] = {0, 0, -1, 1}; // Up, Down
-
-        for (int i = 0; i < 4; ++i) {
-            int newX = cell.x + dx[i];
-            int newY = cell.y + dy[i];
-            if (isValidCoordinate(newX, newY)) {
-                neighbors.push_back({newX, newY});
-            }
-        }
+        GridTopology::forEachNeighbor<GridTopology::Rect4>(cell.x, cell.y, width, height,
+            [&neighbors](int x, int y) { neighbors.push_back({x, y}); });
         return neighbors;
     }
 
@@ -73,6 +128,10 @@ public:
     Cell getCell(int x, int y) const override {
         return {x, y};
     }
+
+    const ObstacleBitGrid& getOccupancy() const override { return occupancy; }
+    GridChangeJournal& getJournal() override { return journal; }
+    const GridChangeJournal& getJournal() const override { return journal; }
 };
 
 #endif // RECTANGULAR_GRID_ADAPTER_H
@@ -4,50 +4,59 @@
 #include "ICollisionDetector.h"
 #include "src/Observer/GameAgent.h"
 #include <cmath>
+#include <algorithm>
 
 // Implementação concreta - detecção de colisão circular
 class CircleCollisionDetector : public ICollisionDetector {
 public:
+    static constexpr size_t PAIR_GRAIN = 8;  // Pontos por bloco
+
+    // Só os pares que o índice espacial encontra dentro do maior raio são
+    // testados, na mesma ordem (i, j) do laço de todos contra todos. Cada
+    // bloco de pontos busca e filtra os próprios pares; os blocos são
+    // concatenados em ordem
     std::vector<CollisionData> detectCollisions(
         const std::vector<GameAgent*>& agents, 
+        const SpatialHash& proximity,
         float warningRadius, 
-        float collisionRadius) override 
+        float collisionRadius,
+        JobSystem& jobs) override 
     {
-        std::vector<CollisionData> collisions;
+        size_t chunks = (proximity.size() + PAIR_GRAIN - 1) / PAIR_GRAIN;
+        std::vector<std::vector<CollisionData>> chunkCollisions(chunks);
+        float maxDistance = std::max(warningRadius, collisionRadius) * 2;
         
-        for (size_t i = 0; i < agents.size(); i++) {
-            if (!agents[i]->isAlive()) continue;
+        jobs.parallelFor(proximity.size(), PAIR_GRAIN, [&](size_t begin, size_t end) {
+            std::vector<SpatialHash::Pair> pairs;
+            proximity.findPairs(maxDistance, begin, end, pairs);
+            std::vector<CollisionData>& collisions = chunkCollisions[begin / PAIR_GRAIN];
             
-            for (size_t j = i + 1; j < agents.size(); j++) {
-                if (!agents[j]->isAlive()) continue;
+            for (const auto& pair : pairs) {
+                size_t i = pair.first;
+                size_t j = pair.second;
+                if (!agents[i]->isAlive() || !agents[j]->isAlive()) continue;
                 
-                Vector2 pos1 = agents[i]->getPosition();
-                Vector2 pos2 = agents[j]->getPosition();
-                float dist = getDistance(pos1, pos2);
+                float dist = pair.distance;
+                // Verifica colisão real primeiro; senão warning (colisão iminente)
+                bool isCollision = dist < collisionRadius * 2;
+                if (!isCollision && !(dist < warningRadius * 2)) continue;
                 
-                // Verifica colisão real primeiro
-                if (dist < collisionRadius * 2) {
-                    CollisionData data;
-                    data.agent1 = agents[i];
-                    data.agent2 = agents[j];
-                    data.distance = dist;
-                    data.collisionPoint = {(pos1.x + pos2.x) / 2, (pos1.y + pos2.y) / 2};
-                    data.isWarning = false;
-                    collisions.push_back(data);
-                }
-                // Verifica warning (colisão iminente)
-                else if (dist < warningRadius * 2) {
-                    CollisionData data;
-                    data.agent1 = agents[i];
-                    data.agent2 = agents[j];
-                    data.distance = dist;
-                    data.collisionPoint = {(pos1.x + pos2.x) / 2, (pos1.y + pos2.y) / 2};
-                    data.isWarning = true;
-                    collisions.push_back(data);
-                }
+                Vector2 pos1 = proximity.getPoint(pair.first);
+                Vector2 pos2 = proximity.getPoint(pair.second);
+                CollisionData data;
+                data.agent1 = agents[i];
+                data.agent2 = agents[j];
+                data.distance = dist;
+                data.collisionPoint = {(pos1.x + pos2.x) / 2, (pos1.y + pos2.y) / 2};
+                data.isWarning = !isCollision;
+                collisions.push_back(data);
             }
-        }
+        });
         
+        std::vector<CollisionData> collisions;
+        for (const auto& chunk : chunkCollisions) {
+            collisions.insert(collisions.end(), chunk.begin(), chunk.end());
+        }
         return collisions;
     }
     
@@ -81,11 +81,14 @@ public:
     bool getShowWarningZone() const { return showWarningZone; }
     bool getShowCollisionZone() const { return showCollisionZone; }
     
-    // Processa colisões para uma lista de agentes
-    void processCollisions(const std::vector<GameAgent*>& agents) {
+    // Processa colisões para uma lista de agentes; `proximity` indexa as
+    // posições deles (ponto i = agents[i]). A detecção roda nas threads de
+    // `jobs`; os observers são notificados depois, em série e em ordem
+    void processCollisions(const std::vector<GameAgent*>& agents, const SpatialHash& proximity,
+                           JobSystem& jobs) {
         if (!enabled || !detector) return;
         
-        auto collisions = detector->detectCollisions(agents, warningRadius, collisionRadius);
+        auto collisions = detector->detectCollisions(agents, proximity, warningRadius, collisionRadius, jobs);
         
         for (auto& collision : collisions) {
             if (collision.isWarning) {
@@ -96,7 +99,8 @@ public:
         }
     }
     
-    // Desenha as zonas de colisão para debug
+    // Desenha as zonas de colisão para debug. O chamador passa só os agentes
+    // visíveis (o GameAgentManager os seleciona pelo índice espacial)
     void drawCollisionZones(const std::vector<GameAgent*>& agents) {
         if (!enabled) return;
         
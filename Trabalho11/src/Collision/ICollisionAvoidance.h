@@ -2,6 +2,8 @@
 #define ICOLLISION_AVOIDANCE_H
 
 #include "src/Observer/GameAgent.h"
+#include "SpatialHash.h"
+#include "src/Core/JobSystem.h"
 #include <vector>
 #include <string>
 
@@ -10,24 +12,35 @@
 // Permite trocar o algoritmo de evasão de colisão em tempo de execução
 class ICollisionAvoidance {
 public:
+    static constexpr size_t STEP_GRAIN = 4;  // Agentes por bloco no doStep()
+
     virtual ~ICollisionAvoidance() = default;
 
     // Nome do método para exibição na UI
     virtual std::string getName() const = 0;
 
-    // Inicializa o sistema com os parâmetros do cenário
-    virtual void initialize(float timeStep, float agentRadius, float maxSpeed) = 0;
+    // Inicializa o sistema com os parâmetros do cenário. `worldSize` é o
+    // tamanho do mapa em pixels (não o da janela)
+    virtual void initialize(float timeStep, float agentRadius, float maxSpeed, Vector2 worldSize) = 0;
 
-    // Sincroniza os agentes do jogo com o sistema de evasão
-    virtual void syncAgents(const std::vector<GameAgent*>& agents) = 0;
+    // Sincroniza os agentes do jogo com o sistema de evasão. O ponto i de
+    // `proximity` é a posição de agents[i], copiada do AgentStore numa
+    // passada linear; as estratégias leem as posições e fazem consultas de
+    // vizinhança por ele. O índice continua válido até o fim do doStep().
+    virtual void syncAgents(const std::vector<GameAgent*>& agents,
+                            const SpatialHash& proximity) = 0;
 
     // Define a velocidade desejada (sem evasão) de cada agente
     virtual void setPreferredVelocities(
         const std::vector<GameAgent*>& agents,
         const std::vector<Vector2>& preferredVelocities) = 0;
 
-    // Executa um passo da simulação de evasão
-    virtual void doStep() = 0;
+    // Executa um passo da simulação de evasão. A vizinhança e a velocidade
+    // de cada agente são calculadas em paralelo por `jobs`, em blocos de
+    // STEP_GRAIN agentes: os dados da vizinhança só são lidos e cada agente
+    // escreve apenas a própria saída, então o resultado não depende do
+    // número de threads
+    virtual void doStep(JobSystem& jobs) = 0;
 
     // Obtém a velocidade corrigida (com evasão) para cada agente
     virtual std::vector<Vector2> getCorrectedVelocities() = 0;
@@ -2,6 +2,8 @@
 #define ICOLLISION_DETECTOR_H
 
 #include "raylib.h"
+#include "SpatialHash.h"
+#include "src/Core/JobSystem.h"
 #include <vector>
 #include <string>
 
@@ -29,11 +31,15 @@ class ICollisionDetector {
 public:
     virtual ~ICollisionDetector() = default;
     
-    // Detecta colisões entre agentes
+    // Detecta colisões entre agentes. `proximity` indexa as posições dos
+    // agentes: o ponto i é a posição de agents[i]. A busca pode ser dividida
+    // entre as threads de `jobs`; a ordem do resultado não depende delas
     virtual std::vector<CollisionData> detectCollisions(
         const std::vector<GameAgent*>& agents, 
+        const SpatialHash& proximity,
         float warningRadius, 
-        float collisionRadius) = 0;
+        float collisionRadius,
+        JobSystem& jobs) = 0;
     
     // Verifica colisão entre dois pontos
     virtual bool checkCollision(Vector2 pos1, Vector2 pos2, float radius1, float radius2) = 0;
@@ -185,6 +185,7 @@ private:
     // Cache
     std::vector<Vector2> correctedVels;
     std::vector<GameAgent*> storedAgents;
+    std::vector<Vector2> storedPositions;
     std::vector<Vector2> storedPreferredVels;
 
 public:
@@ -196,15 +197,15 @@ public:
         return "Comunicacao Indireta";
     }
 
-    void initialize(float ts, float radius, float speed) override {
+    void initialize(float ts, float radius, float speed, Vector2 worldSize) override {
         timeStep = ts;
         agentRadius = radius;
         maxSpeed = speed;
 
         // A grade de ocupação tem resolução baseada no raio do agente
         float cellSize = radius * 2.0f;
-        int gridW = static_cast<int>(800.0f / cellSize) + 1;
-        int gridH = static_cast<int>(600.0f / cellSize) + 1;
+        int gridW = static_cast<int>(worldSize.x / cellSize) + 1;
+        int gridH = static_cast<int>(worldSize.y / cellSize) + 1;
 
         blackboard.initialize(gridW, gridH, cellSize);
 
@@ -216,20 +217,26 @@ public:
                   << " lookAhead=" << lookAheadCells << std::endl;
     }
 
-    void syncAgents(const std::vector<GameAgent*>& agents) override {
+    void syncAgents(const std::vector<GameAgent*>& agents,
+                    const SpatialHash& proximity) override {
+        const std::vector<Vector2>& positions = proximity.getPoints();
         storedAgents.clear();
+        storedPositions.clear();
         storedAgents.reserve(agents.size());
+        storedPositions.reserve(agents.size());
 
         // Início do frame: limpa reservas expiradas
         blackboard.beginFrame();
 
         // Fase de ESCRITA: Cada agente reserva suas células no Blackboard
         // (Comunicação indireta: agentes escrevem no ambiente compartilhado)
-        for (auto* agent : agents) {
+        for (size_t i = 0; i < agents.size(); ++i) {
+            GameAgent* agent = agents[i];
             if (!agent->isAlive()) continue;
             storedAgents.push_back(agent);
 
-            Vector2 pos = agent->getPosition();
+            Vector2 pos = positions[i];
+            storedPositions.push_back(pos);
             GridCellKey cell = blackboard.worldToCell(pos);
 
             // Reserva a célula atual e vizinhas (presença do agente)
@@ -251,7 +258,7 @@ public:
         // Fase de ESCRITA adicional: cada agente reserva as células do seu
         // caminho futuro (comunica sua intenção de rota ao Blackboard)
         for (size_t i = 0; i < storedAgents.size() && i < preferredVelocities.size(); ++i) {
-            Vector2 pos = storedAgents[i]->getPosition();
+            Vector2 pos = storedPositions[i];
             Vector2 vel = preferredVelocities[i];
 
             float velMag = std::sqrt(vel.x * vel.x + vel.y * vel.y);
@@ -270,95 +277,98 @@ public:
         }
     }
 
-    void doStep() override {
+    void doStep(JobSystem& jobs) override {
         if (!active) return;
 
-        correctedVels.clear();
-        correctedVels.reserve(storedAgents.size());
+        correctedVels.assign(storedAgents.size(), {0.0f, 0.0f});
 
         // Fase de LEITURA: cada agente lê o Blackboard para ajustar sua rota
-        // (Comunicação indireta: agentes leem do ambiente compartilhado)
-        for (size_t i = 0; i < storedAgents.size(); ++i) {
-            GameAgent* agent = storedAgents[i];
-            Vector2 pos = agent->getPosition();
-            Vector2 prefVel = (i < storedPreferredVels.size()) ?
-                storedPreferredVels[i] : Vector2{0.0f, 0.0f};
-
-            float velMag = std::sqrt(prefVel.x * prefVel.x + prefVel.y * prefVel.y);
-
-            if (velMag < 0.001f) {
-                correctedVels.push_back(prefVel);
-                continue;
-            }
-
-            // Verifica ocupação das células à frente no caminho desejado
-            Vector2 avoidanceForce = {0.0f, 0.0f};
-            bool pathBlocked = false;
+        // (Comunicação indireta: agentes leem do ambiente compartilhado).
+        // As escritas terminaram em setPreferredVelocities(): aqui os blocos
+        // só leem a grade e cada agente escreve o próprio slot
+        jobs.parallelFor(storedAgents.size(), STEP_GRAIN, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                GameAgent* agent = storedAgents[i];
+                Vector2 pos = storedPositions[i];
+                Vector2 prefVel = (i < storedPreferredVels.size()) ?
+                    storedPreferredVels[i] : Vector2{0.0f, 0.0f};
+
+                float velMag = std::sqrt(prefVel.x * prefVel.x + prefVel.y * prefVel.y);
+
+                if (velMag < 0.001f) {
+                    correctedVels[i] = prefVel;
+                    continue;
+                }
 
-            for (int step = 1; step <= lookAheadCells; ++step) {
-                float factor = static_cast<float>(step) * blackboard.getCellSize();
-                Vector2 checkPos = {
-                    pos.x + (prefVel.x / velMag) * factor,
-                    pos.y + (prefVel.y / velMag) * factor
-                };
-                GridCellKey checkCell = blackboard.worldToCell(checkPos);
-
-                // LÊ o Blackboard: "esta célula está reservada por outro agente?"
-                float occupancy = blackboard.getCellOccupancy(
-                    checkCell.x, checkCell.y, agent);
-
-                if (occupancy > 0.0f) {
-                    pathBlocked = true;
-                    // Peso decresce com a distância (prioriza desvio do mais próximo)
-                    float weight = avoidanceStrength * (1.0f - static_cast<float>(step - 1) / lookAheadCells);
-
-                    // Calcula direção perpendicular para desvio
-                    Vector2 checkWorld = blackboard.cellToWorld(checkCell.x, checkCell.y);
-                    float dx = checkWorld.x - pos.x;
-                    float dy = checkWorld.y - pos.y;
-                    float dist = std::sqrt(dx * dx + dy * dy);
-
-                    if (dist > 0.001f) {
-                        // Força perpendicular ao vetor que aponta para a célula ocupada
-                        // Escolhe lado baseado no índice do agente para quebrar simetria
-                        float sign = (i % 2 == 0) ? 1.0f : -1.0f;
-                        avoidanceForce.x += (-dy / dist) * weight * occupancy * sign;
-                        avoidanceForce.y += (dx / dist) * weight * occupancy * sign;
+                // Verifica ocupação das células à frente no caminho desejado
+                Vector2 avoidanceForce = {0.0f, 0.0f};
+                bool pathBlocked = false;
+
+                for (int step = 1; step <= lookAheadCells; ++step) {
+                    float factor = static_cast<float>(step) * blackboard.getCellSize();
+                    Vector2 checkPos = {
+                        pos.x + (prefVel.x / velMag) * factor,
+                        pos.y + (prefVel.y / velMag) * factor
+                    };
+                    GridCellKey checkCell = blackboard.worldToCell(checkPos);
+
+                    // LÊ o Blackboard: "esta célula está reservada por outro agente?"
+                    float occupancy = blackboard.getCellOccupancy(
+                        checkCell.x, checkCell.y, agent);
+
+                    if (occupancy > 0.0f) {
+                        pathBlocked = true;
+                        // Peso decresce com a distância (prioriza desvio do mais próximo)
+                        float weight = avoidanceStrength * (1.0f - static_cast<float>(step - 1) / lookAheadCells);
+
+                        // Calcula direção perpendicular para desvio
+                        Vector2 checkWorld = blackboard.cellToWorld(checkCell.x, checkCell.y);
+                        float dx = checkWorld.x - pos.x;
+                        float dy = checkWorld.y - pos.y;
+                        float dist = std::sqrt(dx * dx + dy * dy);
+
+                        if (dist > 0.001f) {
+                            // Força perpendicular ao vetor que aponta para a célula ocupada
+                            // Escolhe lado baseado no índice do agente para quebrar simetria
+                            float sign = (i % 2 == 0) ? 1.0f : -1.0f;
+                            avoidanceForce.x += (-dy / dist) * weight * occupancy * sign;
+                            avoidanceForce.y += (dx / dist) * weight * occupancy * sign;
+                        }
                     }
                 }
-            }
 
-            // Também verifica células vizinhas laterais
-            GridCellKey currentCell = blackboard.worldToCell(pos);
-            for (int dy = -1; dy <= 1; ++dy) {
-                for (int dx = -1; dx <= 1; ++dx) {
-                    if (dx == 0 && dy == 0) continue;
-                    float occ = blackboard.getCellOccupancy(
-                        currentCell.x + dx, currentCell.y + dy, agent);
-                    if (occ > 0.0f) {
-                        // Repulsão suave das células vizinhas ocupadas
-                        avoidanceForce.x -= dx * avoidanceStrength * 0.15f * occ;
-                        avoidanceForce.y -= dy * avoidanceStrength * 0.15f * occ;
+                // Também verifica células vizinhas laterais
+                GridCellKey currentCell = blackboard.worldToCell(pos);
+                for (int dy = -1; dy <= 1; ++dy) {
+                    for (int dx = -1; dx <= 1; ++dx) {
+                        if (dx == 0 && dy == 0) continue;
+                        float occ = blackboard.getCellOccupancy(
+                            currentCell.x + dx, currentCell.y + dy, agent);
+                        if (occ > 0.0f) {
+                            // Repulsão suave das células vizinhas ocupadas
+                            avoidanceForce.x -= dx * avoidanceStrength * 0.15f * occ;
+                            avoidanceForce.y -= dy * avoidanceStrength * 0.15f * occ;
+                        }
                     }
                 }
-            }
 
-            // Combina velocidade desejada com força de evasão
-            Vector2 correctedVel = {
-                prefVel.x + avoidanceForce.x,
-                prefVel.y + avoidanceForce.y
-            };
-
-            // Limita à velocidade máxima
-            float speed = std::sqrt(correctedVel.x * correctedVel.x +
-                                    correctedVel.y * correctedVel.y);
-            if (speed > maxSpeed) {
-                correctedVel.x = (correctedVel.x / speed) * maxSpeed;
-                correctedVel.y = (correctedVel.y / speed) * maxSpeed;
-            }
+                // Combina velocidade desejada com força de evasão
+                Vector2 correctedVel = {
+                    prefVel.x + avoidanceForce.x,
+                    prefVel.y + avoidanceForce.y
+                };
 
-            correctedVels.push_back(correctedVel);
-        }
+                // Limita à velocidade máxima
+                float speed = std::sqrt(correctedVel.x * correctedVel.x +
+                                        correctedVel.y * correctedVel.y);
+                if (speed > maxSpeed) {
+                    correctedVel.x = (correctedVel.x / speed) * maxSpeed;
+                    correctedVel.y = (correctedVel.y / speed) * maxSpeed;
+                }
+
+                correctedVels[i] = correctedVel;
+            }
+        });
     }
 
     std::vector<Vector2> getCorrectedVelocities() override {
@@ -108,8 +108,9 @@ public:
     }
 
     // O mediador resolve todas as negociações usando RVO2 (ORCA)
-    // e retorna as velocidades seguras para cada agente
-    std::vector<NegotiatedVelocity> negotiate() {
+    // e retorna as velocidades seguras para cada agente. Vizinhos e
+    // velocidades de cada agente são calculados em paralelo por `jobs`
+    std::vector<NegotiatedVelocity> negotiate(JobSystem& jobs) {
         std::vector<NegotiatedVelocity> results;
         if (registeredIntents.empty()) return results;
 
@@ -134,7 +135,12 @@ public:
         // Passo 2: doStep() — O RVO2 resolve a negociação ORCA
         // Aqui ocorre a comunicação direta: cada par de agentes vizinhos
         // negocia reciprocamente suas velocidades para evitar colisão
+        simulator->setParallelFor(
+            [&jobs](size_t count, const std::function<void(size_t, size_t)>& body) {
+                jobs.parallelFor(count, ICollisionAvoidance::STEP_GRAIN, body);
+            });
         simulator->doStep();
+        simulator->setParallelFor(nullptr);
 
         // Passo 3: Recupera velocidades seguras negociadas
         // getAgentVelocity(id) retorna a velocidade resolvida e segura
@@ -170,8 +176,9 @@ public:
 
 private:
     void rebuildSimulator() {
-        // Verifica se os agentes mudaram
-        bool agentsChanged = false;
+        // Verifica se os agentes mudaram (agentes que chegaram ao destino saem
+        // da lista e não podem continuar no simulador como obstáculos parados)
+        bool agentsChanged = registeredIntents.size() != agentToRvoId.size();
         for (auto& intent : registeredIntents) {
             if (agentToRvoId.find(intent.agent) == agentToRvoId.end()) {
                 agentsChanged = true;
@@ -216,6 +223,7 @@ private:
 
     std::vector<Vector2> lastCorrectedVelocities;
     std::vector<GameAgent*> lastAgents;
+    std::vector<Vector2> lastPositions;
 
 public:
     RVO2CollisionAvoidance() : active(true), timeStep(1.0f / 60.0f),
@@ -225,7 +233,7 @@ public:
         return "Comunicacao Direta";
     }
 
-    void initialize(float ts, float radius, float speed) override {
+    void initialize(float ts, float radius, float speed, Vector2 /*worldSize*/) override {
         timeStep = ts;
         agentRadius = radius;
         maxSpeed = speed;
@@ -238,12 +246,16 @@ public:
     }
 
     // Sincroniza: cada agente se registra no mediador
-    void syncAgents(const std::vector<GameAgent*>& agents) override {
+    void syncAgents(const std::vector<GameAgent*>& agents,
+                    const SpatialHash& proximity) override {
+        const std::vector<Vector2>& positions = proximity.getPoints();
         lastAgents.clear();
-        for (auto* agent : agents) {
-            if (!agent->isAlive()) continue;
-            lastAgents.push_back(agent);
-            mediator.registerAgent(agent, agent->getPosition());
+        lastPositions.clear();
+        for (size_t i = 0; i < agents.size(); ++i) {
+            if (!agents[i]->isAlive()) continue;
+            lastAgents.push_back(agents[i]);
+            lastPositions.push_back(positions[i]);
+            mediator.registerAgent(agents[i], positions[i]);
         }
     }
 
@@ -255,27 +267,25 @@ public:
         for (size_t i = 0; i < lastAgents.size() && i < preferredVelocities.size(); ++i) {
             mediator.sendMovementIntent(
                 lastAgents[i],
-                lastAgents[i]->getPosition(),
+                lastPositions[i],
                 preferredVelocities[i]
             );
         }
     }
 
     // O mediador negocia entre todos os agentes via RVO2
-    void doStep() override {
+    void doStep(JobSystem& jobs) override {
         if (!active) return;
 
-        auto results = mediator.negotiate();
+        auto results = mediator.negotiate(jobs);
 
         lastCorrectedVelocities.clear();
         lastCorrectedVelocities.resize(lastAgents.size(), {0.0f, 0.0f});
 
-        for (auto& result : results) {
-            for (size_t i = 0; i < lastAgents.size(); ++i) {
-                if (lastAgents[i] == result.agent) {
-                    lastCorrectedVelocities[i] = result.safeVelocity;
-                    break;
-                }
+        // negotiate() responde na ordem das intenções, que é a de lastAgents
+        for (size_t i = 0, k = 0; i < lastAgents.size() && k < results.size(); ++i) {
+            if (lastAgents[i] == results[k].agent) {
+                lastCorrectedVelocities[i] = results[k++].safeVelocity;
             }
         }
     }
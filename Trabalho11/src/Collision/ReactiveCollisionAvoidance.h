@@ -99,6 +99,7 @@ private:
     // Cache
     std::vector<Vector2> correctedVels;
     std::vector<GameAgent*> storedAgents;
+    const SpatialHash* storedProximity = nullptr;  // Do GameAgentManager, válido até doStep()
     std::vector<Vector2> storedPreferredVels;
 
     // Sensor de proximidade (cada agente conceitualmente tem o seu)
@@ -113,7 +114,7 @@ public:
         return "Sem Comunicacao";
     }
 
-    void initialize(float ts, float radius, float speed) override {
+    void initialize(float ts, float radius, float speed, Vector2 /*worldSize*/) override {
         timeStep = ts;
         agentRadius = radius;
         maxSpeed = speed;
@@ -134,14 +135,12 @@ public:
                   << " repulsionStrength=" << repulsionStrength << std::endl;
     }
 
-    void syncAgents(const std::vector<GameAgent*>& agents) override {
-        storedAgents.clear();
-        storedAgents.reserve(agents.size());
-        for (auto* agent : agents) {
-            if (agent->isAlive()) {
-                storedAgents.push_back(agent);
-            }
-        }
+    // O GameAgentManager só passa agentes vivos, então o índice i de
+    // storedAgents é o ponto i de `proximity`
+    void syncAgents(const std::vector<GameAgent*>& agents,
+                    const SpatialHash& proximity) override {
+        storedAgents = agents;
+        storedProximity = &proximity;
     }
 
     void setPreferredVelocities(
@@ -150,92 +149,94 @@ public:
         storedPreferredVels = preferredVelocities;
     }
 
-    void doStep() override {
-        if (!active || !sensor) return;
+    void doStep(JobSystem& jobs) override {
+        if (!active || !sensor || !storedProximity) return;
 
-        correctedVels.clear();
-        correctedVels.reserve(storedAgents.size());
-
-        // Pré-coleta todas as posições (o sensor só vê posições, não agentes)
-        std::vector<Vector2> allPositions;
-        allPositions.reserve(storedAgents.size());
-        for (auto* agent : storedAgents) {
-            allPositions.push_back(agent->getPosition());
-        }
+        correctedVels.assign(storedAgents.size(), {0.0f, 0.0f});
 
-        for (size_t i = 0; i < storedAgents.size(); ++i) {
-            Vector2 myPos = storedAgents[i]->getPosition();
-            Vector2 prefVel = (i < storedPreferredVels.size()) ?
-                storedPreferredVels[i] : Vector2{0.0f, 0.0f};
-
-            // Monta lista de posições de obstáculos (exclui a própria posição)
+        // O sensor só vê posições, não agentes. O índice espacial limita a
+        // varredura às posições no alcance do sensor (em ordem de índice,
+        // como a lista completa que ele recebia antes). Cada agente reage
+        // sozinho: os blocos só leem o índice e escrevem o próprio slot
+        const std::vector<Vector2>& allPositions = storedProximity->getPoints();
+        jobs.parallelFor(storedAgents.size(), STEP_GRAIN, [&](size_t begin, size_t end) {
+            std::vector<uint32_t> nearby;
             std::vector<Vector2> obstacles;
-            obstacles.reserve(allPositions.size() - 1);
-            for (size_t j = 0; j < allPositions.size(); ++j) {
-                if (j != i) {
-                    obstacles.push_back(allPositions[j]);
-                }
-            }
 
-            // === SENSOR DE PROXIMIDADE: varre o ambiente ===
-            // Retorna apenas leituras de distância+direção
-            // O agente NÃO sabe o que detectou — apenas "algo está ali"
-            auto readings = sensor->scan(myPos, obstacles);
-
-            // === REAÇÃO AUTÔNOMA: calcula vetor de evasão ===
-            Vector2 totalRepulsion = {0.0f, 0.0f};
-            int readingsInCritical = 0;
-
-            for (const auto& reading : readings) {
-                float forceMagnitude;
-
-                if (reading.distance < criticalDistance) {
-                    // Zona crítica: reação de emergência (forte mas controlada)
-                    forceMagnitude = repulsionStrength * 2.0f *
-                        (1.0f - reading.distance / criticalDistance);
-                    readingsInCritical++;
-                } else {
-                    // Zona normal: reação proporcional inversa
-                    float normalizedDist = reading.distance / detectionRadius;
-                    forceMagnitude = repulsionStrength * (1.0f - normalizedDist);
+            for (size_t i = begin; i < end; ++i) {
+                Vector2 myPos = allPositions[i];
+                Vector2 prefVel = (i < storedPreferredVels.size()) ?
+                    storedPreferredVels[i] : Vector2{0.0f, 0.0f};
+
+                // Monta lista de posições de obstáculos (exclui a própria posição)
+                storedProximity->queryRadius(myPos, sensor->getMaxRange(), nearby);
+                obstacles.clear();
+                for (uint32_t j : nearby) {
+                    if (j != i) {
+                        obstacles.push_back(allPositions[j]);
+                    }
                 }
 
-                // Direção: AFASTA do obstáculo detectado
-                totalRepulsion.x -= reading.directionX * forceMagnitude;
-                totalRepulsion.y -= reading.directionY * forceMagnitude;
-            }
+                // === SENSOR DE PROXIMIDADE: varre o ambiente ===
+                // Retorna apenas leituras de distância+direção
+                // O agente NÃO sabe o que detectou — apenas "algo está ali"
+                auto readings = sensor->scan(myPos, obstacles);
+
+                // === REAÇÃO AUTÔNOMA: calcula vetor de evasão ===
+                Vector2 totalRepulsion = {0.0f, 0.0f};
+                int readingsInCritical = 0;
+
+                for (const auto& reading : readings) {
+                    float forceMagnitude;
+
+                    if (reading.distance < criticalDistance) {
+                        // Zona crítica: reação de emergência (forte mas controlada)
+                        forceMagnitude = repulsionStrength * 2.0f *
+                            (1.0f - reading.distance / criticalDistance);
+                        readingsInCritical++;
+                    } else {
+                        // Zona normal: reação proporcional inversa
+                        float normalizedDist = reading.distance / detectionRadius;
+                        forceMagnitude = repulsionStrength * (1.0f - normalizedDist);
+                    }
+
+                    // Direção: AFASTA do obstáculo detectado
+                    totalRepulsion.x -= reading.directionX * forceMagnitude;
+                    totalRepulsion.y -= reading.directionY * forceMagnitude;
+                }
 
-            // Combina velocidade desejada com reação do sensor
-            Vector2 correctedVel = {
-                prefVel.x + totalRepulsion.x,
-                prefVel.y + totalRepulsion.y
-            };
+                // Combina velocidade desejada com reação do sensor
+                Vector2 correctedVel = {
+                    prefVel.x + totalRepulsion.x,
+                    prefVel.y + totalRepulsion.y
+                };
+
+                // Anti-deadlock: se muitos obstáculos próximos e agente quase parado,
+                // aplica desvio lateral para quebrar simetria
+                if (readingsInCritical >= 2) {
+                    float velMag = std::sqrt(correctedVel.x * correctedVel.x +
+                                            correctedVel.y * correctedVel.y);
+                    if (velMag < maxSpeed * 0.2f && velMag > 0.001f) {
+                        float perpX = -correctedVel.y / velMag;
+                        float perpY = correctedVel.x / velMag;
+                        // Alterna lado baseado no índice para não criar nova simetria
+                        float sign = (i % 2 == 0) ? 1.0f : -1.0f;
+                        correctedVel.x += perpX * maxSpeed * 0.3f * sign;
+                        correctedVel.y += perpY * maxSpeed * 0.3f * sign;
+                    }
+                }
 
-            // Anti-deadlock: se muitos obstáculos próximos e agente quase parado,
-            // aplica desvio lateral para quebrar simetria
-            if (readingsInCritical >= 2) {
-                float velMag = std::sqrt(correctedVel.x * correctedVel.x +
+                // Limita à velocidade máxima
+                float speed = std::sqrt(correctedVel.x * correctedVel.x +
                                         correctedVel.y * correctedVel.y);
-                if (velMag < maxSpeed * 0.2f && velMag > 0.001f) {
-                    float perpX = -correctedVel.y / velMag;
-                    float perpY = correctedVel.x / velMag;
-                    // Alterna lado baseado no índice para não criar nova simetria
-                    float sign = (i % 2 == 0) ? 1.0f : -1.0f;
-                    correctedVel.x += perpX * maxSpeed * 0.3f * sign;
-                    correctedVel.y += perpY * maxSpeed * 0.3f * sign;
+                if (speed > maxSpeed) {
+                    correctedVel.x = (correctedVel.x / speed) * maxSpeed;
+                    correctedVel.y = (correctedVel.y / speed) * maxSpeed;
                 }
-            }
 
-            // Limita à velocidade máxima
-            float speed = std::sqrt(correctedVel.x * correctedVel.x +
-                                    correctedVel.y * correctedVel.y);
-            if (speed > maxSpeed) {
-                correctedVel.x = (correctedVel.x / speed) * maxSpeed;
-                correctedVel.y = (correctedVel.y / speed) * maxSpeed;
+                correctedVels[i] = correctedVel;
             }
-
-            correctedVels.push_back(correctedVel);
-        }
+        });
     }
 
     std::vector<Vector2> getCorrectedVelocities() override {
@@ -6,17 +6,22 @@
 #include "src/Collision/RVO2CollisionAvoidance.h"
 #include "src/Collision/PotentialFieldCollisionAvoidance.h"
 #include "src/Collision/ReactiveCollisionAvoidance.h"
+#include "src/Factories/AStarAlgorithmFactory.h"
 #include <iostream>
 #include <string>
 #include <vector>
 #include <chrono>
 #include <functional>
+#include <thread>
+#include <iomanip>
 
 // =============================================================================
 // SimulationBenchmark — Executa baterias de testes automatizadas
 // =============================================================================
 // Testa os 3 métodos de evasão de colisão com diferentes quantidades de agentes.
 // Coleta métricas e salva via SimulationLogger para gerar gráficos.
+// Opcionalmente, mede no fim o ganho da atualização com 1..N threads
+// (runThreadScaling, ligado por setThreadScalingAgents).
 // =============================================================================
 class SimulationBenchmark {
 private:
@@ -29,6 +34,12 @@ private:
     int maxFrames = 3600;        // Máximo de frames por teste (60s a 60fps)
     float timeoutSeconds = 60.0f;  // Timeout por teste
     float deltaTime = 1.0f / 60.0f;
+    PathfindingAlgorithm pathAlgorithm = PathfindingAlgorithm::ASTAR;  // Busca usada nos testes
+    std::vector<std::string> methodNames = availableMethods();  // Métodos testados, nessa ordem
+    std::string outputPath = "resultados_simulacao.csv";
+    bool seeded = false;         // Sem semente: agentes seguem a sequência aleatória atual
+    unsigned int seed = 0;
+    int scalingAgents = 0;       // runThreadScaling no fim da bateria; 0 = não mede
     
     struct MethodConfig {
         std::string name;       // Nome para o CSV
@@ -42,34 +53,38 @@ public:
     void setAgentCounts(const std::vector<int>& counts) { agentCounts = counts; }
     void setMaxFrames(int frames) { maxFrames = frames; }
     void setTimeoutSeconds(float t) { timeoutSeconds = t; }
+    void setPathfindingAlgorithm(PathfindingAlgorithm algorithm) { pathAlgorithm = algorithm; }
+    void setMethods(const std::vector<std::string>& names) { methodNames = names; }
+    void setOutputPath(const std::string& path) { outputPath = path; }
+    void setThreadScalingAgents(int count) { scalingAgents = count; }
+    // Cada teste sorteia os agentes a partir de seed + quantidade: todos os
+    // métodos veem a mesma população e a bateria se repete igual
+    void setSeed(unsigned int value) {
+        seed = value;
+        seeded = true;
+    }
+    
+    // Nomes aceitos por setMethods (também são os nomes do CSV)
+    static std::vector<std::string> availableMethods() {
+        return {"Direta", "Indireta", "Sem_Comunicacao"};
+    }
     
     // Executa a bateria completa de testes
     void runFullBenchmark() {
         std::cout << "\n========================================================" << std::endl;
         std::cout << "  INICIANDO BATERIA DE TESTES DE EVASAO DE COLISAO" << std::endl;
         std::cout << "========================================================" << std::endl;
-        std::cout << "Metodos: Direta, Indireta, Sem_Comunicacao" << std::endl;
+        std::cout << "Metodos: ";
+        for (const auto& name : methodNames) std::cout << name << " ";
+        std::cout << std::endl;
         std::cout << "Agentes: ";
         for (int c : agentCounts) std::cout << c << " ";
         std::cout << std::endl;
         std::cout << "Max frames por teste: " << maxFrames << std::endl;
+        std::cout << "Algoritmo de busca: " << toString(pathAlgorithm) << std::endl;
         std::cout << "========================================================\n" << std::endl;
         
-        // Define os 3 métodos
-        std::vector<MethodConfig> methods = {
-            {
-                "Direta",
-                []() { return std::make_unique<RVO2CollisionAvoidance>(); }
-            },
-            {
-                "Indireta",
-                []() { return std::make_unique<PotentialFieldCollisionAvoidance>(); }
-            },
-            {
-                "Sem_Comunicacao",
-                []() { return std::make_unique<ReactiveCollisionAvoidance>(); }
-            }
-        };
+        std::vector<MethodConfig> methods = selectedMethods();
         
         SimulationLogger::getInstance()->clear();
         
@@ -87,22 +102,113 @@ public:
         }
         
         // Salva resultados
-        SimulationLogger::getInstance()->saveToCSV("resultados_simulacao.csv");
+        SimulationLogger::getInstance()->saveToCSV(outputPath);
         
         std::cout << "\n========================================================" << std::endl;
         std::cout << "  BATERIA DE TESTES CONCLUIDA!" << std::endl;
         std::cout << "  " << totalTests << " testes executados." << std::endl;
-        std::cout << "  Resultados salvos em: resultados_simulacao.csv" << std::endl;
+        std::cout << "  Resultados salvos em: " << outputPath << std::endl;
+        std::cout << "========================================================\n" << std::endl;
+        
+        if (scalingAgents > 0) runThreadScaling(scalingAgents);
+    }
+    
+    // Tempo por frame de updateAll com 1, 2, 4... threads, sempre com os
+    // mesmos agentes (mesmas células de início e destino), e o ganho em
+    // relação a 1 thread. Mede o frame inteiro como nos testes da bateria:
+    // uma tabela por método selecionado, com a evasão dele ligada.
+    void runThreadScaling(int numAgents = 5000, int frames = 120) {
+        std::cout << "\n========================================================" << std::endl;
+        std::cout << "  ESCALABILIDADE POR THREADS (" << numAgents << " agentes, "
+                  << frames << " frames)" << std::endl;
+        std::cout << "========================================================" << std::endl;
+        
+        int previousThreads = agentManager->getWorkerThreads();
+        
+        // Sorteia a população uma vez e guarda as células
+        agentManager->clearAllAgents();
+        if (seeded) SetRandomSeed(seed);
+        agentManager->addRandomAgents(numAgents);
+        std::vector<std::pair<Vector2, Vector2>> population;
+        for (int i = 0; i < agentManager->getAgentCount(); ++i) {
+            GameAgent* agent = agentManager->getAgent(i);
+            Cell start = agentManager->worldToGrid(agent->getSpawnPosition());
+            population.push_back({{(float)start.x, (float)start.y}, agent->getTarget()});
+        }
+        
+        std::vector<int> threadCounts = {1};
+        int hardware = std::max(1, (int)std::thread::hardware_concurrency());
+        for (int t = 2; t < hardware; t *= 2) threadCounts.push_back(t);
+        if (hardware > 1) threadCounts.push_back(hardware);
+        
+        for (const auto& method : selectedMethods()) {
+            std::cout << "  " << method.name << ":" << std::endl;
+            
+            double baselineMs = 0.0;
+            for (int threads : threadCounts) {
+                agentManager->setWorkerThreads(threads);
+                agentManager->clearAllAgents();
+                for (const auto& agent : population) {
+                    agentManager->addAgent(agent.first, agent.second);
+                }
+                agentManager->setCollisionAvoidance(method.factory());
+                
+                // Aquecimento: caminhos pedidos e entregues antes de medir
+                for (int f = 0; f < 5; ++f) agentManager->updateAll(deltaTime);
+                
+                auto start = std::chrono::high_resolution_clock::now();
+                for (int f = 0; f < frames; ++f) agentManager->updateAll(deltaTime);
+                auto end = std::chrono::high_resolution_clock::now();
+                double frameMs = std::chrono::duration<double, std::milli>(end - start).count() / frames;
+                if (threads == 1) baselineMs = frameMs;
+                
+                std::cout << "    " << threads << " thread(s): " << std::fixed << std::setprecision(3)
+                          << frameMs << " ms/frame | ganho " << std::setprecision(2)
+                          << (frameMs > 0.0 ? baselineMs / frameMs : 0.0) << "x" << std::endl;
+            }
+        }
+        
+        agentManager->setCollisionAvoidanceEnabled(false);
+        agentManager->clearAllAgents();
+        agentManager->setWorkerThreads(previousThreads);
         std::cout << "========================================================\n" << std::endl;
     }
 
 private:
+    // Métodos escolhidos em setMethods, na ordem pedida
+    std::vector<MethodConfig> selectedMethods() const {
+        std::vector<MethodConfig> allMethods = {
+            {
+                "Direta",
+                []() { return std::make_unique<RVO2CollisionAvoidance>(); }
+            },
+            {
+                "Indireta",
+                []() { return std::make_unique<PotentialFieldCollisionAvoidance>(); }
+            },
+            {
+                "Sem_Comunicacao",
+                []() { return std::make_unique<ReactiveCollisionAvoidance>(); }
+            }
+        };
+        std::vector<MethodConfig> methods;
+        for (const auto& name : methodNames) {
+            for (const auto& method : allMethods) {
+                if (method.name == name) methods.push_back(method);
+            }
+        }
+        return methods;
+    }
+    
     void runSingleTest(const MethodConfig& method, int numAgents) {
         // 1. Limpa estado anterior
         agentManager->clearAllAgents();
         agentManager->resetMetrics();
         
-        // 2. Cria agentes aleatórios
+        // 2. Seleciona o algoritmo de busca (A/B entre A* e JPS) e cria agentes aleatórios
+        agentManager->setPathfindingAlgorithm(
+            AStarAlgorithmFactory(pathAlgorithm).CreateAlgorithm(), pathAlgorithm);
+        if (seeded) SetRandomSeed(seed + (unsigned int)numAgents);
         agentManager->addRandomAgents(numAgents);
         
         // 3. Calcula distâncias ideais (linha reta)
@@ -148,6 +254,11 @@ private:
         record.totalColisoes = agentManager->getCollisionCount();
         record.tempoTotalConclusao_s = tempoSimulacao;
         record.distanciaExtraPercorrida = agentManager->getAverageExtraDistance();
+        record.algoritmoCaminho = toString(pathAlgorithm);
+        record.nosExpandidosMedio = static_cast<float>(agentManager->getAverageExpandedNodes());
+        record.usoOrcamentoBusca = static_cast<float>(agentManager->getAveragePathBudgetUse());
+        record.framesOrcamentoEsgotado = static_cast<int>(agentManager->getPathBudgetExhaustedFrames());
+        record.waypointsMedios = static_cast<float>(agentManager->getAverageWaypoints());
         
         SimulationLogger::getInstance()->addRecord(record);
         
@@ -22,6 +22,11 @@ struct SimulationRecord {
     int totalColisoes;                   // Colisões que ocorreram de fato
     float tempoTotalConclusao_s;         // Tempo do início até último agente chegar
     float distanciaExtraPercorrida;      // Diferença entre distância ideal e real (média)
+    std::string algoritmoCaminho = "AStar";  // Algoritmo de busca usado ("AStar", "JPS")
+    float nosExpandidosMedio = 0.0f;     // Média de nós expandidos por busca de caminho
+    float usoOrcamentoBusca = 0.0f;      // Fração média do orçamento de busca por frame (0 = sem orçamento)
+    int framesOrcamentoEsgotado = 0;     // Frames em que o orçamento de busca acabou
+    float waypointsMedios = 0.0f;        // Waypoints por caminho entregue (cai com a suavização)
 };
 
 class SimulationLogger {
@@ -55,6 +60,14 @@ public:
                   << record.tempoTotalConclusao_s << "s"
                   << " | DistExtra=" << std::setprecision(1) 
                   << record.distanciaExtraPercorrida << "px"
+                  << " | Busca=" << record.algoritmoCaminho
+                  << " | NosExpandidos=" << std::setprecision(1)
+                  << record.nosExpandidosMedio
+                  << " | Orcamento=" << std::setprecision(2)
+                  << record.usoOrcamentoBusca
+                  << " (" << record.framesOrcamentoEsgotado << " esgotados)"
+                  << " | Waypoints=" << std::setprecision(1)
+                  << record.waypointsMedios
                   << std::endl;
     }
 
@@ -73,7 +86,12 @@ public:
              << "Tempo_Computacional_Medio_ms,"
              << "Total_Colisoes,"
              << "Tempo_Total_Conclusao_s,"
-             << "Distancia_Extra_Percorrida"
+             << "Distancia_Extra_Percorrida,"
+             << "Algoritmo_Caminho,"
+             << "Nos_Expandidos_Medio,"
+             << "Uso_Orcamento_Busca,"
+             << "Frames_Orcamento_Esgotado,"
+             << "Waypoints_Medios"
              << "\n";
 
         // Dados
@@ -86,7 +104,15 @@ public:
                  << std::setprecision(4) 
                  << record.tempoTotalConclusao_s << ","
                  << std::setprecision(2) 
-                 << record.distanciaExtraPercorrida
+                 << record.distanciaExtraPercorrida << ","
+                 << record.algoritmoCaminho << ","
+                 << std::setprecision(1)
+                 << record.nosExpandidosMedio << ","
+                 << std::setprecision(3)
+                 << record.usoOrcamentoBusca << ","
+                 << record.framesOrcamentoEsgotado << ","
+                 << std::setprecision(1)
+                 << record.waypointsMedios
                  << "\n";
         }
 
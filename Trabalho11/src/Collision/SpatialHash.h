@@ -0,0 +1,189 @@
+#ifndef SPATIAL_HASH_H
+#define SPATIAL_HASH_H
+
+#include "raylib.h"
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstddef>
+
+// =============================================================================
+// SpatialHash — Índice espacial uniforme das posições dos agentes (broadphase)
+// =============================================================================
+// Divide a caixa que envolve os pontos em células quadradas e guarda, por
+// célula, os índices dos pontos que caem nela (lista de células em formato
+// compacto: um array de índices ordenado por célula e o início de cada
+// célula). Construir é O(n) com uma contagem por célula.
+//
+// Uma consulta de raio r só olha as células que o círculo toca; com células
+// do tamanho do maior raio usado, são no máximo 3×3 células. Isso troca os
+// laços O(n²) de todos contra todos por O(n·k), k = vizinhos por célula.
+//
+// Os resultados saem em ordem crescente de índice (pares por (a, b), a < b),
+// a mesma ordem dos laços i < j que o índice substitui: somas e empurrões
+// feitos pelos consumidores dão exatamente o mesmo resultado.
+//
+// Pontos muito espalhados aumentariam a tabela sem limite; nesse caso o
+// tamanho da célula dobra até caberem ~4 células por ponto.
+// =============================================================================
+class SpatialHash {
+public:
+    struct Pair {
+        uint32_t first;   // first < second
+        uint32_t second;
+        float distance;
+    };
+
+private:
+    std::vector<Vector2> points;
+    std::vector<uint32_t> cellStart;  // Início de cada célula em `items` (+1 sentinela)
+    std::vector<uint32_t> items;      // Índices dos pontos agrupados por célula
+    float cellSize = 1.0f;
+    float originX = 0.0f;
+    float originY = 0.0f;
+    int cellsX = 0;
+    int cellsY = 0;
+
+    int columnOf(float x) const {
+        int c = (int)std::floor((x - originX) / cellSize);
+        return std::max(0, std::min(cellsX - 1, c));
+    }
+
+    int rowOf(float y) const {
+        int r = (int)std::floor((y - originY) / cellSize);
+        return std::max(0, std::min(cellsY - 1, r));
+    }
+
+    // Chama visit(i) para cada ponto das células que cobrem o retângulo
+    template <typename Visit>
+    void visitCells(float minX, float minY, float maxX, float maxY, Visit&& visit) const {
+        if (points.empty()) return;
+        int c0 = columnOf(minX), c1 = columnOf(maxX);
+        int r0 = rowOf(minY), r1 = rowOf(maxY);
+        for (int r = r0; r <= r1; ++r) {
+            for (int c = c0; c <= c1; ++c) {
+                int cell = r * cellsX + c;
+                for (uint32_t k = cellStart[cell]; k < cellStart[cell + 1]; ++k) {
+                    visit(items[k]);
+                }
+            }
+        }
+    }
+
+public:
+    // Refaz o índice. `size` deve ser o maior raio (ou distância) que as
+    // consultas vão usar; o índice de cada ponto é a posição dele no vetor.
+    void build(std::vector<Vector2> positions, float size) {
+        points = std::move(positions);
+        cellStart.clear();
+        items.clear();
+        cellsX = cellsY = 0;
+        if (points.empty()) return;
+
+        float minX = points[0].x, maxX = points[0].x;
+        float minY = points[0].y, maxY = points[0].y;
+        for (const Vector2& p : points) {
+            minX = std::min(minX, p.x);
+            maxX = std::max(maxX, p.x);
+            minY = std::min(minY, p.y);
+            maxY = std::max(maxY, p.y);
+        }
+        originX = minX;
+        originY = minY;
+        cellSize = size > 0.0f ? size : 1.0f;
+        size_t maxCells = std::max<size_t>(64, points.size() * 4);
+        for (;;) {
+            double columns = std::floor((maxX - minX) / cellSize) + 1.0;
+            double rows = std::floor((maxY - minY) / cellSize) + 1.0;
+            if (columns * rows <= (double)maxCells) {
+                cellsX = (int)columns;
+                cellsY = (int)rows;
+                break;
+            }
+            cellSize *= 2.0f;
+        }
+
+        // Contagem por célula, soma de prefixos e distribuição estável
+        // (dentro de cada célula os índices ficam em ordem crescente)
+        std::vector<uint32_t> cellOf(points.size());
+        cellStart.assign((size_t)cellsX * cellsY + 1, 0);
+        for (size_t i = 0; i < points.size(); ++i) {
+            cellOf[i] = (uint32_t)(rowOf(points[i].y) * cellsX + columnOf(points[i].x));
+            cellStart[cellOf[i] + 1]++;
+        }
+        for (size_t c = 1; c < cellStart.size(); ++c) {
+            cellStart[c] += cellStart[c - 1];
+        }
+        std::vector<uint32_t> fill(cellStart.begin(), cellStart.end() - 1);
+        items.resize(points.size());
+        for (size_t i = 0; i < points.size(); ++i) {
+            items[fill[cellOf[i]]++] = (uint32_t)i;
+        }
+    }
+
+    size_t size() const { return points.size(); }
+    Vector2 getPoint(uint32_t index) const { return points[index]; }
+    const std::vector<Vector2>& getPoints() const { return points; }
+    float getCellSize() const { return cellSize; }
+
+    // Pontos a no máximo `radius` de `center` (dx² + dy² <= radius²),
+    // em ordem crescente de índice
+    void queryRadius(Vector2 center, float radius, std::vector<uint32_t>& out) const {
+        out.clear();
+        float radiusSq = radius * radius;
+        visitCells(center.x - radius, center.y - radius, center.x + radius, center.y + radius,
+            [&](uint32_t i) {
+                float dx = points[i].x - center.x;
+                float dy = points[i].y - center.y;
+                if (dx * dx + dy * dy <= radiusSq) out.push_back(i);
+            });
+        std::sort(out.begin(), out.end());
+    }
+
+    // Pontos dentro do retângulo, em ordem crescente de índice
+    void queryRect(Rectangle area, std::vector<uint32_t>& out) const {
+        out.clear();
+        visitCells(area.x, area.y, area.x + area.width, area.y + area.height,
+            [&](uint32_t i) {
+                const Vector2& p = points[i];
+                if (p.x >= area.x && p.y >= area.y &&
+                    p.x < area.x + area.width && p.y < area.y + area.height) {
+                    out.push_back(i);
+                }
+            });
+        std::sort(out.begin(), out.end());
+    }
+
+    // Todos os pares (a, b), a < b, com distância < maxDistance, ordenados por
+    // (a, b). A distância é sqrt(dx² + dy²) com dx = b.x - a.x, como nos laços
+    // de todos contra todos.
+    void findPairs(float maxDistance, std::vector<Pair>& out) const {
+        out.clear();
+        findPairs(maxDistance, 0, points.size(), out);
+    }
+
+    // Só os pares cujo primeiro ponto está em [first, last), acrescentados a
+    // `out`. Blocos disjuntos podem rodar em threads diferentes; concatenados
+    // em ordem, dão o mesmo resultado da versão completa.
+    void findPairs(float maxDistance, size_t first, size_t last, std::vector<Pair>& out) const {
+        std::vector<Pair> partners;
+        for (uint32_t a = (uint32_t)first; a < last; ++a) {
+            Vector2 p = points[a];
+            partners.clear();
+            visitCells(p.x - maxDistance, p.y - maxDistance, p.x + maxDistance, p.y + maxDistance,
+                [&](uint32_t b) {
+                    if (b <= a) return;
+                    float dx = points[b].x - p.x;
+                    float dy = points[b].y - p.y;
+                    float distance = std::sqrt(dx * dx + dy * dy);
+                    if (distance < maxDistance) partners.push_back({a, b, distance});
+                });
+            std::sort(partners.begin(), partners.end(),
+                      [](const Pair& x, const Pair& y) { return x.second < y.second; });
+            out.insert(out.end(), partners.begin(), partners.end());
+        }
+    }
+};
+
+#endif // SPATIAL_HASH_H
@@ -0,0 +1,103 @@
+#ifndef PAINT_STROKE_COMMAND_H
+#define PAINT_STROKE_COMMAND_H
+
+#include "BaseCommand.h"
+#include "src/Interfaces/IGridAdapter.h"
+#include "src/Observer/GridChangeNotifier.h"
+#include "src/Core/Cell.h"
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+
+// =============================================================================
+// PaintStrokeCommand — Uma pincelada de obstáculos, do clique até soltar
+// =============================================================================
+// Com um SetObstacleCommand por frame (mesmo parado na mesma célula), uma
+// pincelada enchia o histórico de 100 comandos e expulsava os undos úteis.
+// Aqui a pincelada inteira é um comando só.
+//
+// Durante a pincelada, paint() aplica na hora cada célula que de fato muda e
+// a notifica sozinha (os observers reparam uma célula incrementalmente). Só
+// células que mudaram são guardadas, então o estado anterior de todas é o
+// oposto de `blocked` e não precisa ser armazenado. finish() ordena as
+// células e as compacta em trechos horizontais (linha, coluna, comprimento).
+//
+// undo() e o redo (execute()) reaplicam os trechos num único
+// GridChangeNotifier::bulkEdit: uma entrada no diário, um REGION_CHANGED e
+// uma invalidação de cache, qualquer que seja o tamanho da pincelada.
+// =============================================================================
+class PaintStrokeCommand : public BaseCommand {
+private:
+    struct Run {
+        int32_t y;
+        int32_t x;
+        int32_t length;
+    };
+
+    IGridAdapter* grid;
+    bool blocked;                // Estado pintado; o anterior é o oposto
+    std::vector<Cell> painted;   // Células alteradas, até finish()
+    std::vector<Run> runs;
+    size_t cellCount = 0;
+    bool applied = true;         // paint() já deixou as células no estado pintado
+
+    void applyRuns(bool state) {
+        GridChangeNotifier::getInstance()->bulkEdit(grid, [this, state]() {
+            for (const Run& run : runs) {
+                for (int x = run.x; x < run.x + run.length; ++x) {
+                    grid->SetObstacle(x, run.y, state);
+                }
+            }
+        });
+    }
+
+public:
+    PaintStrokeCommand(IGridAdapter* g, bool paintBlocked) : grid(g), blocked(paintBlocked) {}
+
+    // Pinta uma célula; fora do mapa ou já no estado pintado, nada acontece
+    void paint(int x, int y) {
+        uint64_t before = grid->getJournal().getVersion();
+        grid->SetObstacle(x, y, blocked);
+        if (grid->getJournal().getVersion() == before) return;
+        GridChangeNotifier::getInstance()->cellChanged(grid, x, y, blocked);
+        painted.push_back({x, y});
+    }
+
+    // Fim da pincelada: compacta as células alteradas em trechos
+    void finish() {
+        std::sort(painted.begin(), painted.end(), [](const Cell& a, const Cell& b) {
+            return a.y != b.y ? a.y < b.y : a.x < b.x;
+        });
+        runs.clear();
+        for (const Cell& cell : painted) {
+            if (!runs.empty() && runs.back().y == cell.y && runs.back().x + runs.back().length == cell.x) {
+                runs.back().length++;
+            } else {
+                runs.push_back({cell.y, cell.x, 1});
+            }
+        }
+        runs.shrink_to_fit();
+        cellCount = painted.size();
+        std::vector<Cell>().swap(painted);
+    }
+
+    // A primeira execução não faz nada (paint() já aplicou); o redo reaplica
+    void execute() override {
+        if (applied) return;
+        applyRuns(blocked);
+        applied = true;
+    }
+
+    void undo() override {
+        if (!applied) return;
+        applyRuns(!blocked);
+        applied = false;
+    }
+
+    bool isBlocking() const { return blocked; }
+    bool isEmpty() const { return cellCount == 0 && painted.empty(); }
+    size_t getCellCount() const { return cellCount; }
+    size_t getRunCount() const { return runs.size(); }
+};
+
+#endif // PAINT_STROKE_COMMAND_H
@@ -3,6 +3,7 @@
 
 #include "BaseCommand.h"
 #include "src/Interfaces/IGridAdapter.h"
+#include "src/Observer/GridChangeNotifier.h"
 
 // Command para definir/remover obstáculos no grid
 class SetObstacleCommand : public BaseCommand {
@@ -13,6 +14,17 @@ private:
     bool previousState;
     bool executed;
 
+    // Só notifica se a célula realmente mudou (o diário do grid avançou).
+    // Dentro de um GridChangeNotifier::bulkEdit o diário acumula a célula no
+    // lote e o evento sai uma vez só, como REGION_CHANGED.
+    void apply(bool state) {
+        uint64_t before = grid->getJournal().getVersion();
+        grid->SetObstacle(x, y, state);
+        if (grid->getJournal().getVersion() != before) {
+            GridChangeNotifier::getInstance()->cellChanged(grid, x, y, state);
+        }
+    }
+
 public:
     SetObstacleCommand(IGridAdapter* g, int px, int py, bool state) 
         : grid(g), x(px), y(py), newState(state), previousState(false), executed(false) {}
@@ -20,14 +32,14 @@ public:
     void execute() override {
         if (grid && grid->isValidCoordinate(x, y)) {
             previousState = !grid->IsWalkable(x, y);
-            grid->SetObstacle(x, y, newState);
+            apply(newState);
             executed = true;
         }
     }
     
     void undo() override {
         if (executed && grid && grid->isValidCoordinate(x, y)) {
-            grid->SetObstacle(x, y, previousState);
+            apply(previousState);
         }
     }
 };
@@ -6,7 +6,7 @@
 #include "src/ChainOfResponsibility/PathfinderInitHandler.h"
 #include "src/ChainOfResponsibility/AgentManagerInitHandler.h"
 #include "src/Commands/CommandManager.h"
-#include "src/Commands/SetObstacleCommand.h"
+#include "src/Commands/PaintStrokeCommand.h"
 #include "src/Commands/SpawnAgentCommand.h"
 #include "src/Observer/GameAgentManager.h"
 #include "src/Adapters/HexagonalGridAdapter.h"
@@ -15,7 +15,11 @@
 #include "src/Collision/ReactiveCollisionAvoidance.h"
 #include "src/Collision/SimulationLogger.h"
 #include "src/Collision/SimulationBenchmark.h"
+#include "src/Factories/AStarAlgorithmFactory.h"
 #include <iostream>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
 
 Application::Application(std::unique_ptr<IAppFactory> f) : factory(std::move(f)) {
     // Inicialização será feita via Chain of Responsibility
@@ -56,6 +60,7 @@ bool Application::InitializeWithChain() {
         // Inicializa o novo sistema de agentes com Observer (suporta hex e retangular)
         if (gridAdapter) {
             gameAgentManager = std::make_unique<GameAgentManager>(gridAdapter, currentGridType);
+            applyPathfindingAlgorithm();
         }
         
         std::cout << "=== Sistema inicializado com sucesso! ===\n" << std::endl;
@@ -73,6 +78,9 @@ void Application::Run() {
     }
     
     while (!WindowShouldClose()) {
+        // Sujeira do mapa passa a contar a partir deste frame
+        gridAdapter->getJournal().beginFrame();
+
         // Processa comandos agendados
         CommandManager::getInstance()->processPendingCommands();
         
@@ -84,22 +92,169 @@ void Application::Run() {
 
 void Application::reinitializeGrid(GridType newGridType) {
     if (currentGridType == newGridType) return;
+    rebuildGrid(newGridType);
+}
+
+// Recria o grid (e os gerenciadores de agentes) no tamanho atual: o da
+// janela ou, com o mapa grande ligado, largeWorldCells × largeWorldCells
+void Application::rebuildGrid(GridType gridType) {
+    currentGridType = gridType;
+    int cols = largeWorldCells;
+    int rows = largeWorldCells;
+    if (!largeWorld) {
+        GridManager::gridSizeFor(gridType, (float)screenWidth, (float)screenHeight, cols, rows);
+    }
+    GridManager::getInstance()->switchGrid(gridType, cols, rows);
+    attachGrid(nullptr);
+}
 
-    currentGridType = newGridType;
-    GridManager::getInstance()->switchGrid(newGridType, screenWidth / cellSize, screenHeight / cellSize);
+// Recria os gerenciadores de agentes sobre o grid atual do GridManager;
+// `map` é o arquivo de onde ele veio (dados pré-calculados), se houver
+void Application::attachGrid(const MapFile* map) {
     gridAdapter = GridManager::getInstance()->getGrid();
+    activeStroke.reset();
+    camera = {{0.0f, 0.0f}, {0.0f, 0.0f}, 0.0f, 1.0f};
     
     spawnPos = {-1, -1};
     targetPos = {-1, -1};
     
     legacyAgentManager = std::make_unique<AgentManager>(&gridAdapter->GetLegacyGrid());
-    gameAgentManager = std::make_unique<GameAgentManager>(gridAdapter, currentGridType);
+    gameAgentManager = std::make_unique<GameAgentManager>(gridAdapter, currentGridType, map);
+    applyPathfindingAlgorithm();
     
     // Limpa histórico de comandos ao trocar de grid
     CommandManager::getInstance()->clearHistory();
 }
 
+// Grava obstáculos, componentes conexas e landmarks do mapa atual
+void Application::saveMap() {
+    if (!gameAgentManager) return;
+    std::string error;
+    if (gameAgentManager->saveMap(mapFilePath, &error)) {
+        std::cout << "[Mapa] Salvo em " << mapFilePath << std::endl;
+    } else {
+        std::cout << "[Mapa] Falha ao salvar: " << error << std::endl;
+    }
+}
+
+// Troca o grid pelo do arquivo; o tamanho e o tipo vêm do arquivo
+void Application::loadMap() {
+    auto start = std::chrono::steady_clock::now();
+    MapFile map;
+    std::string error;
+    if (!map.open(mapFilePath, &error)) {
+        std::cout << "[Mapa] Falha ao carregar: " << error << std::endl;
+        return;
+    }
+    
+    // Os gerenciadores observam o grid antigo: saem antes de ele ser destruído
+    gameAgentManager.reset();
+    legacyAgentManager.reset();
+    if (GridManager::getInstance()->loadGrid(map)) {
+        currentGridType = map.getGridType();
+        attachGrid(&map);
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        std::cout << "[Mapa] " << mapFilePath << ": " << map.getWidth() << "x" << map.getHeight()
+                  << " carregado em " << ms << " ms" << std::endl;
+    } else {
+        std::cout << "[Mapa] Arquivo corrompido: " << mapFilePath << std::endl;
+        rebuildGrid(currentGridType);
+    }
+}
+
+// Área do mundo (pixels) que aparece na janela com a câmera atual
+Rectangle Application::visibleWorldArea() const {
+    Vector2 topLeft = GetScreenToWorld2D({0.0f, 0.0f}, camera);
+    Vector2 bottomRight = GetScreenToWorld2D({(float)screenWidth, (float)screenHeight}, camera);
+    return {topLeft.x, topLeft.y, bottomRight.x - topLeft.x, bottomRight.y - topLeft.y};
+}
+
+// Setas ou botão do meio movem a câmera; a roda aproxima em torno do mouse.
+// O zoom mínimo mostra o mapa inteiro e a câmera não sai dos limites do mapa.
+void Application::updateCamera() {
+    if (!gridAdapter) return;
+    Vector2 world = gridAdapter->getWorldSize();
+
+    float wheel = GetMouseWheelMove();
+    if (wheel != 0.0f) {
+        Vector2 mouse = GetMousePosition();
+        Vector2 anchor = GetScreenToWorld2D(mouse, camera);
+        float minZoom = std::min(1.0f, std::min(screenWidth / world.x, screenHeight / world.y));
+        camera.zoom = std::max(minZoom, std::min(4.0f, camera.zoom * (1.0f + 0.1f * wheel)));
+        camera.offset = mouse;
+        camera.target = anchor;
+    }
+
+    float pan = 600.0f * GetFrameTime() / camera.zoom;
+    if (IsKeyDown(KEY_RIGHT)) camera.target.x += pan;
+    if (IsKeyDown(KEY_LEFT)) camera.target.x -= pan;
+    if (IsKeyDown(KEY_DOWN)) camera.target.y += pan;
+    if (IsKeyDown(KEY_UP)) camera.target.y -= pan;
+    if (IsMouseButtonDown(MOUSE_BUTTON_MIDDLE)) {
+        Vector2 delta = GetMouseDelta();
+        camera.target.x -= delta.x / camera.zoom;
+        camera.target.y -= delta.y / camera.zoom;
+    }
+
+    Rectangle view = visibleWorldArea();
+    auto clampAxis = [](float start, float size, float limit) {
+        if (size >= limit) return -start;                // Mapa menor que a tela: encosta na origem
+        if (start < 0.0f) return -start;
+        if (start + size > limit) return limit - (start + size);
+        return 0.0f;
+    };
+    camera.target.x += clampAxis(view.x, view.width, world.x);
+    camera.target.y += clampAxis(view.y, view.height, world.y);
+}
+
+// Célula do grid sob um ponto do mundo
+Cell Application::cellAt(Vector2 worldPos) const {
+    if (currentGridType == GridType::RECTANGULAR) {
+        return {(int)(worldPos.x / cellSize), (int)(worldPos.y / cellSize)};
+    }
+    // Grid hexagonal - usa o método do adapter
+    auto* hexAdapter = dynamic_cast<HexagonalGridAdapter*>(gridAdapter);
+    return hexAdapter ? hexAdapter->getClickedCell(worldPos) : Cell{0, 0};
+}
+
+// Pinta o segmento desde a posição do frame anterior: arrastar rápido não
+// deixa buracos entre as células
+void Application::paintStroke(Vector2 worldPos) {
+    float dx = worldPos.x - lastStrokePos.x;
+    float dy = worldPos.y - lastStrokePos.y;
+    int steps = std::max(1, (int)std::ceil(std::sqrt(dx * dx + dy * dy) / (cellSize * 0.5f)));
+    for (int i = 1; i <= steps; ++i) {
+        float t = (float)i / steps;
+        Cell cell = cellAt({lastStrokePos.x + dx * t, lastStrokePos.y + dy * t});
+        activeStroke->paint(cell.x, cell.y);
+    }
+    lastStrokePos = worldPos;
+}
+
+// Fecha a pincelada e a coloca no histórico (se mudou alguma célula)
+void Application::finishStroke() {
+    if (!activeStroke) return;
+    activeStroke->finish();
+    if (!activeStroke->isEmpty()) {
+        CommandManager::getInstance()->executeCommand(activeStroke);
+    }
+    activeStroke.reset();
+}
+
+// Aplica o algoritmo de busca selecionado aos gerenciadores de agentes
+void Application::applyPathfindingAlgorithm() {
+    if (gameAgentManager) {
+        gameAgentManager->setPathfindingAlgorithm(
+            AStarAlgorithmFactory(pathAlgorithm).CreateAlgorithm(), pathAlgorithm);
+    }
+    if (legacyAgentManager) {
+        legacyAgentManager->SetAlgorithm(pathAlgorithm);
+    }
+}
+
 void Application::HandleInput() {
+    updateCamera();
+
     // Grid type switching
     if (IsKeyPressed(KEY_H)) {
         reinitializeGrid(GridType::HEXAGONAL);
@@ -107,6 +262,19 @@ void Application::HandleInput() {
     if (IsKeyPressed(KEY_J)) {
         reinitializeGrid(GridType::RECTANGULAR);
     }
+    // Alterna entre o mapa do tamanho da janela e o mapa grande
+    if (IsKeyPressed(KEY_F3)) {
+        largeWorld = !largeWorld;
+        rebuildGrid(currentGridType);
+    }
+    
+    // Salva / carrega o mapa em arquivo
+    if (IsKeyPressed(KEY_F5)) {
+        saveMap();
+    }
+    if (IsKeyPressed(KEY_F9)) {
+        loadMap();
+    }
     
     // Toggle entre sistema novo e legado
     if (IsKeyPressed(KEY_N)) {
@@ -115,6 +283,71 @@ void Application::HandleInput() {
                   << (useNewAgentSystem ? "NOVO (Observer)" : "LEGADO") << std::endl;
     }
     
+    // Alterna algoritmo de busca (A* <-> JPS)
+    if (IsKeyPressed(KEY_A)) {
+        pathAlgorithm = (pathAlgorithm == PathfindingAlgorithm::ASTAR) ?
+            PathfindingAlgorithm::JPS : PathfindingAlgorithm::ASTAR;
+        applyPathfindingAlgorithm();
+    }
+    
+    // Liga/desliga busca hierárquica (HPA*)
+    if (IsKeyPressed(KEY_E)) {
+        if (useNewAgentSystem && gameAgentManager) {
+            gameAgentManager->setHierarchicalPathfinding(
+                !gameAgentManager->isHierarchicalPathfinding());
+        }
+    }
+    
+    // Liga/desliga navegação por flow field (campo compartilhado por destino)
+    if (IsKeyPressed(KEY_F)) {
+        if (useNewAgentSystem && gameAgentManager) {
+            gameAgentManager->setFlowFieldNavigation(
+                !gameAgentManager->isFlowFieldNavigation());
+        }
+    }
+    
+    // Liga/desliga buscas assíncronas (pool de threads)
+    if (IsKeyPressed(KEY_Q)) {
+        if (useNewAgentSystem && gameAgentManager) {
+            gameAgentManager->setAsyncPathfinding(!gameAgentManager->isAsyncPathfinding());
+        }
+    }
+    
+    // Liga/desliga buscas fatiadas com orçamento por frame
+    if (IsKeyPressed(KEY_O)) {
+        if (useNewAgentSystem && gameAgentManager) {
+            gameAgentManager->setTimeSlicedPathfinding(!gameAgentManager->isTimeSlicedPathfinding());
+        }
+    }
+    
+    // Liga/desliga suavização any-angle dos caminhos
+    if (IsKeyPressed(KEY_U)) {
+        if (useNewAgentSystem && gameAgentManager) {
+            gameAgentManager->setPathSmoothing(!gameAgentManager->isPathSmoothing());
+        }
+    }
+    
+    // Liga/desliga heurística ALT (landmarks)
+    if (IsKeyPressed(KEY_L)) {
+        if (useNewAgentSystem && gameAgentManager) {
+            gameAgentManager->setLandmarkHeuristic(!gameAgentManager->isLandmarkHeuristic());
+        }
+    }
+    
+    // Liga/desliga busca cooperativa em janela (WHCA*)
+    if (IsKeyPressed(KEY_F2)) {
+        if (useNewAgentSystem && gameAgentManager) {
+            gameAgentManager->setCooperativePathfinding(!gameAgentManager->isCooperativePathfinding());
+        }
+    }
+    
+    // Liga/desliga replanejamento incremental (D* Lite por agente)
+    if (IsKeyPressed(KEY_W)) {
+        if (useNewAgentSystem && gameAgentManager) {
+            gameAgentManager->setIncrementalReplanning(!gameAgentManager->isIncrementalReplanning());
+        }
+    }
+    
     // Toggle estatísticas
     if (IsKeyPressed(KEY_I)) {
         showStatistics = !showStatistics;
@@ -123,46 +356,40 @@ void Application::HandleInput() {
         }
     }
     
-    // Undo/Redo com Command Pattern
+    // Undo/Redo com Command Pattern (uma pincelada em andamento entra antes
+    // no histórico)
     if (IsKeyPressed(KEY_Z) && IsKeyDown(KEY_LEFT_CONTROL)) {
+        finishStroke();
         if (CommandManager::getInstance()->undo()) {
             std::cout << "[Command] Undo executado!" << std::endl;
         }
     }
     if (IsKeyPressed(KEY_Y) && IsKeyDown(KEY_LEFT_CONTROL)) {
+        finishStroke();
         if (CommandManager::getInstance()->redo()) {
             std::cout << "[Command] Redo executado!" << std::endl;
         }
     }
 
     // Input handling for obstacle and target placement
-    Vector2 mousePos = GetMousePosition();
-    int gridX, gridY;
-    
-    if (currentGridType == GridType::RECTANGULAR) {
-        gridX = mousePos.x / cellSize;
-        gridY = mousePos.y / cellSize;
-    } else {
-        // Grid hexagonal - usa o método do adapter
-        auto* hexAdapter = dynamic_cast<HexagonalGridAdapter*>(gridAdapter);
-        if (hexAdapter) {
-            Cell hexCell = hexAdapter->getClickedCell(mousePos);
-            gridX = hexCell.x;
-            gridY = hexCell.y;
-        } else {
-            gridX = 0;
-            gridY = 0;
-        }
-    }
+    Vector2 mousePos = GetScreenToWorld2D(GetMousePosition(), camera);
+    Cell mouseCell = cellAt(mousePos);
+    int gridX = mouseCell.x;
+    int gridY = mouseCell.y;
 
-    // Usa Command Pattern para obstáculos (funciona para ambos os grids)
-    if (IsMouseButtonDown(MOUSE_BUTTON_LEFT)) {
-        auto cmd = std::make_shared<SetObstacleCommand>(gridAdapter, gridX, gridY, true);
-        CommandManager::getInstance()->executeCommand(cmd);
+    // Obstáculos com Command Pattern: do clique até soltar o botão é uma
+    // pincelada só (esquerdo bloqueia, direito libera)
+    bool blockButton = IsMouseButtonDown(MOUSE_BUTTON_LEFT);
+    bool clearButton = IsMouseButtonDown(MOUSE_BUTTON_RIGHT) && !placingSpawn && !placingTarget;
+    if (activeStroke && !(activeStroke->isBlocking() ? blockButton : clearButton)) {
+        finishStroke();
     }
-    if (IsMouseButtonDown(MOUSE_BUTTON_RIGHT) && !placingSpawn && !placingTarget) {
-        auto cmd = std::make_shared<SetObstacleCommand>(gridAdapter, gridX, gridY, false);
-        CommandManager::getInstance()->executeCommand(cmd);
+    if (!activeStroke && (blockButton || clearButton)) {
+        activeStroke = std::make_shared<PaintStrokeCommand>(gridAdapter, blockButton);
+        lastStrokePos = mousePos;
+    }
+    if (activeStroke) {
+        paintStroke(mousePos);
     }
 
     if (IsKeyPressed(KEY_S)) {
@@ -276,7 +503,18 @@ void Application::HandleInput() {
     
     if (IsKeyPressed(KEY_P)) {
         Metrics::Clear();
-        RunPerformanceTests();
+        RunPerformanceTests(pathAlgorithm);
+    }
+    
+    // Relógio da simulação: pausa e avanço rápido
+    if (IsKeyPressed(KEY_SPACE)) {
+        simulationClock.togglePaused();
+    }
+    if (IsKeyPressed(KEY_F6)) {
+        simulationClock.slowDown();
+    }
+    if (IsKeyPressed(KEY_F7)) {
+        simulationClock.speedUp();
     }
     
     // F1: Executa benchmark completo e salva CSV automaticamente
@@ -285,6 +523,7 @@ void Application::HandleInput() {
             std::cout << "\n[Benchmark] Iniciando bateria de testes..." << std::endl;
             SimulationBenchmark benchmark(
                 gameAgentManager.get(), gridAdapter, currentGridType);
+            benchmark.setPathfindingAlgorithm(pathAlgorithm);
             benchmark.runFullBenchmark();
             // Restaura estado: limpa agentes do benchmark
             gameAgentManager->clearAllAgents();
@@ -294,11 +533,17 @@ void Application::HandleInput() {
     }
 }
 
+// O tempo do frame vira 0..N passos fixos; o desenho interpola entre eles
 void Application::Update() {
     if (useNewAgentSystem && gameAgentManager) {
-        gameAgentManager->updateAll(GetFrameTime());
+        gameAgentManager->setViewport(visibleWorldArea());
+        simulationClock.tick(GetFrameTime(), [this](float step) {
+            gameAgentManager->updateAll(step);
+        });
     } else if (legacyAgentManager) {
-        legacyAgentManager->UpdateAll(GetFrameTime());
+        simulationClock.tick(GetFrameTime(), [this](float step) {
+            legacyAgentManager->UpdateAll(step);
+        });
     }
 }
 
@@ -324,10 +569,76 @@ void Application::DrawUI() {
     DrawText(TextFormat("Agentes: %d", agentCount), 10, y, 18, GREEN);
     y += lineHeight;
     
-    DrawText(TextFormat("Grid: %s (H/J para trocar)", 
-        currentGridType == GridType::RECTANGULAR ? "Retangular" : "Hexagonal"), 10, y, 18, GREEN);
+    DrawText(TextFormat("Grid: %s %dx%d (H/J para trocar) | Mapa grande: %s (F3, setas/roda)", 
+        currentGridType == GridType::RECTANGULAR ? "Retangular" : "Hexagonal",
+        gridAdapter ? gridAdapter->GetWidth() : 0, gridAdapter ? gridAdapter->GetHeight() : 0,
+        largeWorld ? "ON" : "OFF"), 10, y, 18, GREEN);
+    y += lineHeight;
+    DrawText(TextFormat("Mapa em arquivo: F5 salva | F9 carrega (%s)", mapFilePath), 10, y, 18, GREEN);
     y += lineHeight;
     
+    bool hierarchical = gameAgentManager && gameAgentManager->isHierarchicalPathfinding();
+    DrawText(TextFormat("Busca: %s (A para trocar) | HPA*: %s (E)", toString(pathAlgorithm),
+        hierarchical ? "ON" : "OFF"), 10, y, 18, GREEN);
+    y += lineHeight;
+    
+    if (gameAgentManager && gameAgentManager->isFlowFieldNavigation()) {
+        DrawText(TextFormat("Flow field: ON (F) | Campos ativos: %d",
+            (int)gameAgentManager->getFlowFieldCount()), 10, y, 18, GREEN);
+    } else {
+        DrawText("Flow field: OFF (F)", 10, y, 18, GREEN);
+    }
+    y += lineHeight;
+    
+    if (gameAgentManager) {
+        PathCache* cache = gameAgentManager->getPathCache();
+        DrawText(TextFormat("Cache de caminhos: %d entradas | acertos %.0f%%",
+            (int)cache->getSize(), cache->getHitRate() * 100.0), 10, y, 18, GREEN);
+        y += lineHeight;
+        
+        DrawText(TextFormat("Busca assincrona: %s (Q) | Pendentes: %d",
+            gameAgentManager->isAsyncPathfinding() ? "ON" : "OFF",
+            (int)gameAgentManager->getPendingPathQueries()), 10, y, 18, GREEN);
+        y += lineHeight;
+        
+        if (PathfindingScheduler* scheduler = gameAgentManager->getPathfindingScheduler()) {
+            DrawText(TextFormat("Orcamento de busca (O): %d/%d exp | %.0f/%.0f us | esgotado %d frames",
+                scheduler->getLastFrameExpansions(), scheduler->getExpansionBudget(),
+                scheduler->getLastFrameTimeUs(), scheduler->getTimeBudgetUs(),
+                (int)scheduler->getExhaustedFrames()), 10, y, 18, GREEN);
+        } else {
+            DrawText("Orcamento de busca: OFF (O)", 10, y, 18, GREEN);
+        }
+        y += lineHeight;
+        
+        DrawText(TextFormat("D* Lite incremental: %s (W)",
+            gameAgentManager->isIncrementalReplanning() ? "ON" : "OFF"), 10, y, 18, GREEN);
+        y += lineHeight;
+        
+        DrawText(TextFormat("Suavizacao de caminhos: %s (U) | %.1f waypoints/caminho",
+            gameAgentManager->isPathSmoothing() ? "ON" : "OFF",
+            gameAgentManager->getAverageWaypoints()), 10, y, 18, GREEN);
+        y += lineHeight;
+        
+        if (LandmarkHeuristic* alt = gameAgentManager->getLandmarkHeuristic()) {
+            DrawText(TextFormat("Heuristica ALT (L): %d landmarks | %s", alt->getLandmarkCount(),
+                alt->current() ? "ativa" : (alt->isBuilding() ? "calculando" : "aguardando")),
+                10, y, 18, GREEN);
+        } else {
+            DrawText("Heuristica ALT: OFF (L)", 10, y, 18, GREEN);
+        }
+        y += lineHeight;
+        
+        if (CooperativePlanner* planner = gameAgentManager->getCooperativePlanner()) {
+            DrawText(TextFormat("Busca cooperativa (F2): janela %d | passo %d | %d agentes",
+                planner->getWindow(), (int)planner->getStep(), planner->getActiveAgents()),
+                10, y, 18, GREEN);
+        } else {
+            DrawText("Busca cooperativa: OFF (F2)", 10, y, 18, GREEN);
+        }
+        y += lineHeight;
+    }
+    
     // Informações dos padrões de projeto
     DrawText("--- Padrões de Projeto ---", 10, y, 18, BLUE);
     y += lineHeight;
@@ -346,6 +657,15 @@ void Application::DrawUI() {
     DrawText("C: Toggle Colisoes | I: Estatisticas", 10, y, 18, ORANGE);
     y += lineHeight;
     
+    const char* clockMode = simulationClock.isPaused() ? "PAUSADA" :
+        simulationClock.getMode() == SimulationClock::Mode::REAL_TIME ? "tempo real" :
+        simulationClock.getMode() == SimulationClock::Mode::MAX_SPEED ? "maxima" :
+        TextFormat("%d passos/frame", simulationClock.getStepsPerFrame());
+    DrawText(TextFormat("Simulacao: %s | %d passos no frame | %.1fs (ESPACO, F6/F7)",
+        clockMode, simulationClock.getLastSteps(), simulationClock.getSimulatedSeconds()),
+        10, y, 18, ORANGE);
+    y += lineHeight;
+    
     if (gameAgentManager) {
         auto* avoidance = gameAgentManager->getCollisionAvoidance();
         if (avoidance && gameAgentManager->isCollisionAvoidanceEnabled()) {
@@ -384,11 +704,12 @@ void Application::Render() {
     BeginDrawing();
     ClearBackground(RAYWHITE);
 
+    BeginMode2D(camera);
     if (gridAdapter) {
-        gridAdapter->Draw();
+        gridAdapter->DrawArea(visibleWorldArea());
         
         if (useNewAgentSystem && gameAgentManager) {
-            gameAgentManager->drawAll();
+            gameAgentManager->drawAll(simulationClock.getAlpha());
         } else if (legacyAgentManager) {
             legacyAgentManager->DrawAll(gridAdapter->GetLegacyGrid());
         }
@@ -418,6 +739,7 @@ void Application::Render() {
             DrawRectangleRec({targetPos.x * cellSize, targetPos.y * cellSize, cellSize, cellSize}, Fade(RED, 0.5f));
         }
     }
+    EndMode2D();
     
     DrawUI();
 
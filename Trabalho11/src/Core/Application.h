@@ -8,11 +8,15 @@
 #include "src/Interfaces/IAlgorithm.h"
 #include "src/Interfaces/IInitHandler.h"
 #include "Core/GridType.h"
+#include "Core/PathfindingAlgorithm.h"
+#include "Core/MapFile.h"
+#include "Core/SimulationClock.h"
 #include "Trabalho9_Legacy.h"
 
 // Forward declarations para os novos padrões
 class GameAgentManager;
 class CommandManager;
+class PaintStrokeCommand;
 
 class Application {
 public:
@@ -27,12 +31,30 @@ private:
     void Update();
     void Render();
     void reinitializeGrid(GridType newGridType);
+    void rebuildGrid(GridType gridType);
+    void attachGrid(const MapFile* map);
+    void saveMap();
+    void loadMap();
+    void updateCamera();
+    Rectangle visibleWorldArea() const;
+    void applyPathfindingAlgorithm();
+    Cell cellAt(Vector2 worldPos) const;
+    void paintStroke(Vector2 worldPos);
+    void finishStroke();
     void DrawUI();
 
     const int screenWidth = 800;
     const int screenHeight = 600;
     const float cellSize = 20.0f;
 
+    // Mapa grande (F3): dimensões em células, independentes da janela
+    static constexpr int largeWorldCells = 2000;
+    // Mapa salvo (F5) e carregado (F9), com os dados pré-calculados
+    static constexpr const char* mapFilePath = "mapa.t11map";
+    bool largeWorld = false;
+    // Câmera sobre o mundo: setas/botão do meio movem, roda do mouse dá zoom
+    Camera2D camera = {{0.0f, 0.0f}, {0.0f, 0.0f}, 0.0f, 1.0f};
+
     std::unique_ptr<IAppFactory> factory;
     std::unique_ptr<IGrid> grid;
     IGridAdapter* gridAdapter;
@@ -49,9 +71,20 @@ private:
     bool placingSpawn = false;
     bool placingTarget = false;
     
+    // Pincelada de obstáculos em andamento (botão ainda pressionado)
+    std::shared_ptr<PaintStrokeCommand> activeStroke;
+    Vector2 lastStrokePos = {0, 0};
+    
     // Flags para demonstração dos padrões
     bool useNewAgentSystem = true;  // Usa o novo sistema com Observer
     bool showStatistics = false;
+    
+    // Algoritmo de busca no grid retangular (A: alterna A*/JPS)
+    PathfindingAlgorithm pathAlgorithm = PathfindingAlgorithm::ASTAR;
+    
+    // Passo fixo da simulação, separado da taxa de desenho
+    // (ESPAÇO pausa, F6/F7 mais devagar/mais rápido)
+    SimulationClock simulationClock;
 };
 
 #endif // APPLICATION_H
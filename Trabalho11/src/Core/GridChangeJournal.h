@@ -0,0 +1,177 @@
+#ifndef GRID_CHANGE_JOURNAL_H
+#define GRID_CHANGE_JOURNAL_H
+
+#include <deque>
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+
+// Retângulo de células com limites inclusivos (vazio quando x1 < x0)
+struct GridRect {
+    int x0 = 0;
+    int y0 = 0;
+    int x1 = -1;
+    int y1 = -1;
+
+    static GridRect cell(int x, int y) { return {x, y, x, y}; }
+
+    bool isEmpty() const { return x1 < x0 || y1 < y0; }
+    bool contains(int x, int y) const { return x >= x0 && x <= x1 && y >= y0 && y <= y1; }
+    long long area() const { return isEmpty() ? 0 : (long long)(x1 - x0 + 1) * (y1 - y0 + 1); }
+
+    void include(int x, int y) {
+        if (isEmpty()) {
+            *this = cell(x, y);
+            return;
+        }
+        x0 = std::min(x0, x);
+        y0 = std::min(y0, y);
+        x1 = std::max(x1, x);
+        y1 = std::max(y1, y);
+    }
+
+    void include(const GridRect& other) {
+        if (other.isEmpty()) return;
+        include(other.x0, other.y0);
+        include(other.x1, other.y1);
+    }
+};
+
+// Uma entrada do diário: a área alterada e a versão que ela gerou
+struct GridChangeRecord {
+    uint64_t version;
+    GridRect area;      // Uma célula, ou a caixa de uma edição em lote
+    bool cleared;       // Alguma célula da área passou a ser livre
+};
+
+// =============================================================================
+// GridChangeJournal — Diário de alterações de obstáculos de um grid
+// =============================================================================
+// Cada adapter tem o seu; SetObstacle registra aqui toda célula que mudou de
+// fato, então nenhuma alteração passa despercebida. O GridChangeNotifier
+// continua sendo o canal "push" (observers reagem na hora); o diário é o
+// canal "pull":
+//   - getVersion(): contador monotônico, avança a cada entrada. Quem guarda
+//     resultados derivados do mapa compara versões em vez de manter o seu
+//     próprio contador. getLastClearVersion() é a versão da última liberação
+//     (até lá, bloquear só piora caminhos; liberar pode encurtá-los);
+//   - changesSince(v): entradas posteriores a v, para reparo incremental. O
+//     diário guarda no máximo `capacity` entradas; se v já foi descartada,
+//     retorna false e o consumidor reconstrói do zero;
+//   - beginBulk()/endBulk(): edições em lote (carregar mapa, pincel grande)
+//     viram UMA entrada com a caixa da região, em vez de uma por célula;
+//   - sujeira do frame: retângulos alterados desde beginFrame(), para quem
+//     redesenha ou reprocessa só o que mudou no frame.
+// =============================================================================
+class GridChangeJournal {
+public:
+    static constexpr size_t DEFAULT_CAPACITY = 4096;
+    static constexpr size_t MAX_FRAME_RECTS = 256;  // Acima disso, só a caixa total
+
+private:
+    std::deque<GridChangeRecord> records;  // Da mais antiga à mais nova
+    size_t capacity;
+    uint64_t version = 0;
+    uint64_t completeSince = 0;     // changesSince(v) é completo para v >= isto
+    uint64_t lastClearVersion = 0;
+
+    int bulkDepth = 0;
+    GridRect bulkArea;
+    bool bulkCleared = false;
+
+    std::vector<GridRect> frameRects;
+    GridRect frameBounds;
+
+    void append(const GridRect& area, bool cleared) {
+        version++;
+        if (cleared) lastClearVersion = version;
+        records.push_back({version, area, cleared});
+        if (records.size() > capacity) {
+            completeSince = records.front().version;
+            records.pop_front();
+        }
+
+        frameBounds.include(area);
+        if (frameRects.size() < MAX_FRAME_RECTS) {
+            frameRects.push_back(area);
+        } else {
+            frameRects.assign(1, frameBounds);
+        }
+    }
+
+public:
+    explicit GridChangeJournal(size_t maxRecords = DEFAULT_CAPACITY)
+        : capacity(std::max<size_t>(1, maxRecords)) {}
+
+    // Chamado por SetObstacle quando a célula realmente mudou
+    void record(int x, int y, bool blocked) {
+        if (bulkDepth > 0) {
+            bulkArea.include(x, y);
+            bulkCleared = bulkCleared || !blocked;
+            return;
+        }
+        append(GridRect::cell(x, y), !blocked);
+    }
+
+    // Chamado quando uma área inteira foi trocada de uma vez (mapa carregado
+    // de arquivo); `cleared` se alguma célula pode ter sido liberada
+    void recordArea(const GridRect& area, bool cleared) {
+        if (area.isEmpty()) return;
+        if (bulkDepth > 0) {
+            bulkArea.include(area);
+            bulkCleared = bulkCleared || cleared;
+            return;
+        }
+        append(area, cleared);
+    }
+
+    // Edições em lote podem ser aninhadas; só a mais externa gera a entrada
+    void beginBulk() {
+        if (bulkDepth++ == 0) {
+            bulkArea = GridRect();
+            bulkCleared = false;
+        }
+    }
+
+    // Fecha o lote. Retorna true (e a caixa em `area`) se algo mudou
+    bool endBulk(GridRect& area) {
+        if (bulkDepth == 0 || --bulkDepth > 0 || bulkArea.isEmpty()) return false;
+        append(bulkArea, bulkCleared);
+        area = bulkArea;
+        return true;
+    }
+
+    // Um grid novo (switchGrid) continua a numeração do anterior, para que
+    // versões guardadas do mapa antigo nunca casem com as do novo
+    void rebase(uint64_t baseVersion) {
+        records.clear();
+        version = std::max(version, baseVersion);
+        completeSince = version;
+        lastClearVersion = version;
+    }
+
+    // Acrescenta a `out` as entradas com versão > since. Retorna false se
+    // parte delas já foi descartada (o consumidor deve reconstruir)
+    bool changesSince(uint64_t since, std::vector<GridChangeRecord>& out) const {
+        if (since < completeSince) return false;
+        auto first = std::upper_bound(records.begin(), records.end(), since,
+            [](uint64_t v, const GridChangeRecord& record) { return v < record.version; });
+        out.insert(out.end(), first, records.end());
+        return true;
+    }
+
+    // Início do frame: esquece a sujeira do frame anterior
+    void beginFrame() {
+        frameRects.clear();
+        frameBounds = GridRect();
+    }
+
+    const std::vector<GridRect>& getFrameDirty() const { return frameRects; }
+    GridRect getFrameBounds() const { return frameBounds; }
+
+    uint64_t getVersion() const { return version; }
+    uint64_t getLastClearVersion() const { return lastClearVersion; }
+    bool isInBulk() const { return bulkDepth > 0; }
+};
+
+#endif // GRID_CHANGE_JOURNAL_H
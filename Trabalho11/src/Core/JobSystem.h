@@ -0,0 +1,158 @@
+#ifndef JOB_SYSTEM_H
+#define JOB_SYSTEM_H
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <vector>
+#include <algorithm>
+#include <cstddef>
+
+// =============================================================================
+// JobSystem — Threads por núcleo com roubo de trabalho, para laços paralelos
+// =============================================================================
+// parallelFor() divide [0, count) em blocos de `grain` itens e distribui os
+// blocos entre as filas das threads (uma fila por thread; a fila 0 é da
+// thread que chamou). Cada thread consome a própria fila pelo fim e, quando
+// ela esvazia, rouba do começo da fila de outra — quem termina antes ajuda
+// quem pegou blocos mais caros.
+//
+// parallelFor() só retorna quando todos os blocos terminaram (barreira): a
+// thread que chama também executa blocos enquanto espera. Os blocos devem
+// escrever em dados disjuntos; o que é compartilhado (observers, caches,
+// buscas) fica para um passo serial depois da barreira.
+//
+// Com uma thread, ou com um bloco só, o laço roda direto na thread que
+// chamou, sem acordar ninguém. Só uma thread por vez chama parallelFor().
+// =============================================================================
+class JobSystem {
+public:
+    using RangeFunction = std::function<void(size_t begin, size_t end)>;
+
+private:
+    struct Job {
+        const RangeFunction* body;
+        size_t begin;
+        size_t end;
+        std::atomic<size_t>* pending;
+    };
+
+    struct WorkQueue {
+        std::mutex mutex;
+        std::deque<Job> jobs;
+    };
+
+    std::vector<std::unique_ptr<WorkQueue>> queues;  // queues[0]: thread que chama
+    std::vector<std::thread> workers;
+    std::mutex sleepMutex;
+    std::condition_variable wake;
+    std::atomic<size_t> queuedJobs{0};
+    bool stopping = false;
+
+    bool popLocal(size_t queue, Job& job) {
+        WorkQueue& own = *queues[queue];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (own.jobs.empty()) return false;
+        job = own.jobs.back();
+        own.jobs.pop_back();
+        return true;
+    }
+
+    bool steal(size_t thief, Job& job) {
+        for (size_t k = 1; k < queues.size(); ++k) {
+            WorkQueue& victim = *queues[(thief + k) % queues.size()];
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            if (victim.jobs.empty()) continue;
+            job = victim.jobs.front();
+            victim.jobs.pop_front();
+            return true;
+        }
+        return false;
+    }
+
+    bool runOne(size_t queue) {
+        Job job;
+        if (!popLocal(queue, job) && !steal(queue, job)) return false;
+        queuedJobs.fetch_sub(1, std::memory_order_relaxed);
+        (*job.body)(job.begin, job.end);
+        job.pending->fetch_sub(1, std::memory_order_release);
+        return true;
+    }
+
+    void workerLoop(size_t queue) {
+        while (true) {
+            if (runOne(queue)) continue;
+            std::unique_lock<std::mutex> lock(sleepMutex);
+            wake.wait(lock, [this] { return stopping || queuedJobs.load(std::memory_order_relaxed) > 0; });
+            if (stopping) return;
+        }
+    }
+
+public:
+    // `threadCount` conta a thread que chama; 0 = uma por núcleo
+    explicit JobSystem(int threadCount = 0) {
+        if (threadCount <= 0) {
+            threadCount = std::max(1, (int)std::thread::hardware_concurrency());
+        }
+        for (int i = 0; i < threadCount; ++i) {
+            queues.push_back(std::make_unique<WorkQueue>());
+        }
+        for (int i = 1; i < threadCount; ++i) {
+            workers.emplace_back(&JobSystem::workerLoop, this, (size_t)i);
+        }
+    }
+
+    ~JobSystem() {
+        {
+            std::lock_guard<std::mutex> lock(sleepMutex);
+            stopping = true;
+        }
+        wake.notify_all();
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    size_t getThreadCount() const { return queues.size(); }
+
+    // Chama body(begin, end) para cada bloco de até `grain` itens de
+    // [0, count) e espera todos terminarem
+    void parallelFor(size_t count, size_t grain, const RangeFunction& body) {
+        if (count == 0) return;
+        grain = std::max<size_t>(1, grain);
+        size_t chunks = (count + grain - 1) / grain;
+        if (chunks == 1 || workers.empty()) {
+            for (size_t begin = 0; begin < count; begin += grain) {
+                body(begin, std::min(count, begin + grain));
+            }
+            return;
+        }
+
+        std::atomic<size_t> pending(chunks);
+        queuedJobs.fetch_add(chunks, std::memory_order_relaxed);
+        for (size_t c = 0; c < chunks; ++c) {
+            size_t begin = c * grain;
+            WorkQueue& queue = *queues[c % queues.size()];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            queue.jobs.push_back({&body, begin, std::min(count, begin + grain), &pending});
+        }
+        {
+            std::lock_guard<std::mutex> lock(sleepMutex);
+        }
+        wake.notify_all();
+
+        // A thread que chama trabalha (e rouba) até o último bloco acabar
+        while (pending.load(std::memory_order_acquire) > 0) {
+            if (!runOne(0)) std::this_thread::yield();
+        }
+    }
+};
+
+#endif // JOB_SYSTEM_H
@@ -0,0 +1,438 @@
+#ifndef MAP_FILE_H
+#define MAP_FILE_H
+
+#include "src/Core/ObstacleBitGrid.h"
+#include "src/Core/GridType.h"
+#include "src/Core/Cell.h"
+#include <string>
+#include <vector>
+#include <memory>
+#include <fstream>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <cstdio>
+#include <type_traits>
+
+#if !defined(_WIN32)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#else
+// Só a declaração do kernel32 (os mesmos tipos de BOOL/LPCSTR/DWORD): o
+// <windows.h> inteiro conflita com o raylib
+extern "C" __declspec(dllimport) int __stdcall MoveFileExA(const char* existingName, const char* newName,
+                                                           unsigned long flags);
+#endif
+
+// =============================================================================
+// MapFile — Mapa binário versionado, carregado por mmap sem conversão
+// =============================================================================
+// Layout (little-endian, tudo alinhado a 64 bytes):
+//   Header (64 bytes)       magic, versão do formato, tipo de grid, dimensões,
+//                           TILE_SHIFT e quantas seções existem
+//   Section[sectionCount]   id, count, offset e tamanho de cada seção
+//   seções                  os dados, exatamente como ficam na memória
+//
+// Seções:
+//   TILE_INDEX          uint32 por tile do ObstacleBitGrid: 0 = todo livre,
+//                       1 = todo bloqueado, 2 + i = bloco i de TILE_BLOCKS
+//   TILE_BLOCKS         blocos de TILE_SIZE palavras de 64 bits (só os tiles
+//                       mistos ocupam espaço no arquivo)
+//   REACHABILITY        int32 por célula: componente conexa (-1 = obstáculo);
+//                       count = número de componentes
+//   LANDMARK_CELLS      Cell[count] dos landmarks da heurística ALT
+//   LANDMARK_DISTANCES  uint16 [célula * count + k], o layout da LandmarkTable
+//
+// Só TILE_INDEX/TILE_BLOCKS são obrigatórias; ids desconhecidos são ignorados
+// (arquivos mais novos continuam abrindo). open() só valida cabeçalho e
+// tamanhos — nada é convertido: os tiles do ObstacleBitGrid e a tabela de
+// landmarks apontam direto para o mapeamento, e o SO lê do disco só as
+// páginas tocadas. O mapeamento é privado: escrever num tile nunca altera o
+// arquivo.
+//
+// Sem mmap (Windows: <windows.h> conflita com o raylib) o arquivo é lido
+// inteiro para um buffer e o resto funciona igual.
+// =============================================================================
+class MapFile {
+public:
+    enum SectionId : uint32_t {
+        TILE_INDEX = 1,
+        TILE_BLOCKS = 2,
+        REACHABILITY = 3,
+        LANDMARK_CELLS = 4,
+        LANDMARK_DISTANCES = 5
+    };
+
+    static constexpr uint32_t FORMAT_VERSION = 1;
+    static constexpr uint32_t BYTE_ORDER_MARK = 0x01020304;
+    static constexpr size_t ALIGNMENT = 64;
+
+    struct Header {
+        char magic[8];
+        uint32_t byteOrder;
+        uint32_t formatVersion;
+        uint32_t gridType;
+        int32_t width;
+        int32_t height;
+        int32_t tileShift;
+        uint32_t sectionCount;
+        uint32_t reserved[7];
+    };
+
+    struct Section {
+        uint32_t id;
+        uint32_t count;
+        uint64_t offset;
+        uint64_t bytes;
+    };
+
+    // O que save() grava; ponteiros nulos omitem a seção
+    struct Contents {
+        const ObstacleBitGrid* occupancy = nullptr;
+        GridType gridType = GridType::RECTANGULAR;
+        const int32_t* labels = nullptr;          // width * height rótulos
+        int32_t labelCount = 0;
+        const Cell* landmarks = nullptr;
+        int landmarkCount = 0;
+        const uint16_t* landmarkDistances = nullptr;  // width * height * landmarkCount
+    };
+
+private:
+    static_assert(sizeof(Header) == 64, "Header do MapFile deve ter 64 bytes");
+    static_assert(sizeof(Section) == 24, "Section do MapFile deve ter 24 bytes");
+    static_assert(sizeof(Cell) == 2 * sizeof(int32_t) && std::is_trivially_copyable<Cell>::value,
+                  "Cell é gravada como dois int32");
+
+    static constexpr char MAGIC[8] = {'T', 'R', 'B', '1', '1', 'M', 'A', 'P'};
+
+    // Bytes do arquivo: mapeados (munmap no destrutor) ou num buffer
+    struct Region {
+        const uint8_t* data = nullptr;
+        size_t size = 0;
+        bool mapped = false;
+        std::vector<uint8_t> buffer;
+
+        ~Region() {
+#if !defined(_WIN32)
+            if (mapped) munmap(const_cast<uint8_t*>(data), size);
+#endif
+        }
+    };
+
+    std::shared_ptr<const Region> region;
+    const Header* header = nullptr;
+    const Section* sections = nullptr;
+
+    static bool fail(std::string* error, const std::string& message) {
+        if (error) *error = message;
+        return false;
+    }
+
+    // Troca `path` pelo arquivo recém-escrito num passo só: quem abre `path`
+    // encontra o mapa antigo ou o novo, nunca um arquivo faltando
+    static bool replaceFile(const std::string& written, const std::string& path) {
+#if !defined(_WIN32)
+        return std::rename(written.c_str(), path.c_str()) == 0;
+#else
+        const unsigned long replaceExisting = 0x1;  // MOVEFILE_REPLACE_EXISTING
+        const unsigned long writeThrough = 0x8;     // MOVEFILE_WRITE_THROUGH
+        return MoveFileExA(written.c_str(), path.c_str(), replaceExisting | writeThrough) != 0;
+#endif
+    }
+
+    static uint64_t alignUp(uint64_t value) {
+        return (value + ALIGNMENT - 1) & ~(uint64_t)(ALIGNMENT - 1);
+    }
+
+    static bool load(const std::string& path, Region& out, std::string* error) {
+#if !defined(_WIN32)
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) return fail(error, "nao foi possivel abrir " + path);
+        struct stat info;
+        if (fstat(fd, &info) != 0 || info.st_size <= 0) {
+            ::close(fd);
+            return fail(error, "arquivo vazio: " + path);
+        }
+        out.size = (size_t)info.st_size;
+        void* data = mmap(nullptr, out.size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if (data == MAP_FAILED) return fail(error, "mmap falhou: " + path);
+        out.data = static_cast<const uint8_t*>(data);
+        out.mapped = true;
+        return true;
+#else
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        if (!file) return fail(error, "nao foi possivel abrir " + path);
+        std::streamsize size = file.tellg();
+        if (size <= 0) return fail(error, "arquivo vazio: " + path);
+        out.buffer.resize((size_t)size);
+        file.seekg(0);
+        if (!file.read(reinterpret_cast<char*>(out.buffer.data()), size)) {
+            return fail(error, "erro de leitura: " + path);
+        }
+        out.data = out.buffer.data();
+        out.size = out.buffer.size();
+        return true;
+#endif
+    }
+
+    // Tamanho esperado de cada seção conhecida (0 = qualquer)
+    uint64_t expectedBytes(const Section& section) const {
+        uint64_t cells = (uint64_t)header->width * header->height;
+        uint64_t tiles = (uint64_t)tilesX() * tilesY();
+        switch (section.id) {
+            case TILE_INDEX: return tiles * sizeof(uint32_t);
+            case TILE_BLOCKS: return (uint64_t)section.count * ObstacleBitGrid::TILE_SIZE * sizeof(uint64_t);
+            case REACHABILITY: return cells * sizeof(int32_t);
+            case LANDMARK_CELLS: return (uint64_t)section.count * sizeof(Cell);
+            case LANDMARK_DISTANCES: return cells * section.count * sizeof(uint16_t);
+            default: return 0;
+        }
+    }
+
+    int tilesX() const {
+        return (header->width + ObstacleBitGrid::TILE_SIZE - 1) >> ObstacleBitGrid::TILE_SHIFT;
+    }
+
+    int tilesY() const {
+        return (header->height + ObstacleBitGrid::TILE_SIZE - 1) >> ObstacleBitGrid::TILE_SHIFT;
+    }
+
+    template <typename T>
+    const T* sectionData(uint32_t id, uint32_t* count = nullptr) const {
+        if (!header) return nullptr;
+        for (uint32_t i = 0; i < header->sectionCount; ++i) {
+            if (sections[i].id != id) continue;
+            if (count) *count = sections[i].count;
+            return reinterpret_cast<const T*>(region->data + sections[i].offset);
+        }
+        return nullptr;
+    }
+
+    void close() {
+        region.reset();
+        header = nullptr;
+        sections = nullptr;
+    }
+
+public:
+    // Mapeia o arquivo e valida cabeçalho e seções. Nada é copiado
+    bool open(const std::string& path, std::string* error = nullptr) {
+        close();
+        auto loaded = std::make_shared<Region>();
+        if (!load(path, *loaded, error)) return false;
+        region = loaded;
+
+        if (region->size < sizeof(Header)) {
+            close();
+            return fail(error, "arquivo menor que o cabecalho");
+        }
+        header = reinterpret_cast<const Header*>(region->data);
+        if (std::memcmp(header->magic, MAGIC, sizeof(MAGIC)) != 0) {
+            close();
+            return fail(error, "nao e um arquivo de mapa");
+        }
+        if (header->byteOrder != BYTE_ORDER_MARK) {
+            close();
+            return fail(error, "ordem de bytes diferente da maquina");
+        }
+        if (header->formatVersion != FORMAT_VERSION) {
+            uint32_t version = header->formatVersion;
+            close();
+            return fail(error, "versao de formato nao suportada: " + std::to_string(version));
+        }
+        if (header->width <= 0 || header->height <= 0 ||
+            header->tileShift != ObstacleBitGrid::TILE_SHIFT ||
+            header->gridType > (uint32_t)GridType::HEXAGONAL) {
+            close();
+            return fail(error, "cabecalho invalido");
+        }
+
+        uint64_t tableEnd = sizeof(Header) + (uint64_t)header->sectionCount * sizeof(Section);
+        if (tableEnd > region->size) {
+            close();
+            return fail(error, "tabela de secoes truncada");
+        }
+        sections = reinterpret_cast<const Section*>(region->data + sizeof(Header));
+        for (uint32_t i = 0; i < header->sectionCount; ++i) {
+            const Section& section = sections[i];
+            uint64_t expected = expectedBytes(section);
+            if (section.offset % alignof(uint64_t) != 0 || section.offset < tableEnd ||
+                section.offset > region->size || section.bytes > region->size - section.offset ||
+                (expected != 0 && section.bytes != expected) ||
+                (section.id == TILE_INDEX && section.count != (uint32_t)tilesX() * tilesY())) {
+                close();
+                return fail(error, "secao " + std::to_string(section.id) + " invalida");
+            }
+        }
+        if (!sectionData<uint32_t>(TILE_INDEX)) {
+            close();
+            return fail(error, "mapa sem obstaculos (TILE_INDEX)");
+        }
+
+        uint32_t cellCount = 0;
+        uint32_t distanceCount = 0;
+        const Cell* cells = sectionData<Cell>(LANDMARK_CELLS, &cellCount);
+        if (sectionData<uint16_t>(LANDMARK_DISTANCES, &distanceCount) && (!cells || cellCount != distanceCount)) {
+            close();
+            return fail(error, "landmarks incompletos");
+        }
+        for (uint32_t k = 0; cells && k < cellCount; ++k) {
+            if (cells[k].x < 0 || cells[k].x >= header->width || cells[k].y < 0 || cells[k].y >= header->height) {
+                close();
+                return fail(error, "landmark fora do mapa");
+            }
+        }
+        return true;
+    }
+
+    bool isOpen() const { return header != nullptr; }
+    GridType getGridType() const { return (GridType)header->gridType; }
+    int getWidth() const { return header->width; }
+    int getHeight() const { return header->height; }
+    size_t getFileBytes() const { return region ? region->size : 0; }
+
+    // Mantém o arquivo mapeado enquanto existir (para visões como a LandmarkTable)
+    std::shared_ptr<const void> getOwner() const { return region; }
+
+    // Obstáculos do mapa: tiles uniformes viram os blocos compartilhados e os
+    // mistos apontam para o arquivo. Falha se o índice citar bloco inexistente
+    bool readOccupancy(ObstacleBitGrid& out) const {
+        uint32_t blockCount = 0;
+        const uint32_t* index = sectionData<uint32_t>(TILE_INDEX);
+        const uint64_t* blocks = sectionData<uint64_t>(TILE_BLOCKS, &blockCount);
+        if (!blocks) blockCount = 0;
+
+        ObstacleBitGrid grid(header->width, header->height);
+        std::shared_ptr<const void> owner = region;
+        int tx = tilesX();
+        for (int ty = 0, t = 0; ty < tilesY(); ++ty) {
+            for (int x = 0; x < tx; ++x, ++t) {
+                uint32_t entry = index[t];
+                if (entry <= 1) {
+                    grid.setUniformTile(x, ty, entry == 1);
+                } else if (entry - 2 < blockCount) {
+                    grid.shareTile(x, ty, owner, blocks + (size_t)(entry - 2) * ObstacleBitGrid::TILE_SIZE);
+                } else {
+                    return false;
+                }
+            }
+        }
+        out = std::move(grid);
+        return true;
+    }
+
+    // Rótulos de componente por célula, ou nullptr se o arquivo não tem
+    const int32_t* getReachabilityLabels(int32_t& labelCount) const {
+        uint32_t count = 0;
+        const int32_t* labels = sectionData<int32_t>(REACHABILITY, &count);
+        labelCount = (int32_t)count;
+        return labels;
+    }
+
+    // Landmarks e distâncias, ou nullptr se o arquivo não tem
+    const uint16_t* getLandmarkDistances(const Cell*& landmarks, int& landmarkCount) const {
+        uint32_t count = 0;
+        landmarks = sectionData<Cell>(LANDMARK_CELLS, &count);
+        landmarkCount = (int)count;
+        return landmarks ? sectionData<uint16_t>(LANDMARK_DISTANCES) : nullptr;
+    }
+
+    // Grava `contents` em `path` no formato acima
+    static bool save(const std::string& path, const Contents& contents, std::string* error = nullptr) {
+        if (!contents.occupancy) return fail(error, "nada para gravar");
+        const ObstacleBitGrid& occupancy = *contents.occupancy;
+        const int width = occupancy.getWidth();
+        const int height = occupancy.getHeight();
+        const uint64_t cells = (uint64_t)width * height;
+        const size_t tileWords = ObstacleBitGrid::TILE_SIZE;
+
+        // Índice de tiles: uniformes não gravam bloco
+        std::vector<uint32_t> index;
+        std::vector<const uint64_t*> blocks;
+        index.reserve((size_t)occupancy.getTilesX() * occupancy.getTilesY());
+        for (int ty = 0; ty < occupancy.getTilesY(); ++ty) {
+            for (int tx = 0; tx < occupancy.getTilesX(); ++tx) {
+                bool blocked = false;
+                if (occupancy.isUniformTile(tx, ty, blocked)) {
+                    index.push_back(blocked ? 1 : 0);
+                } else {
+                    index.push_back(2 + (uint32_t)blocks.size());
+                    blocks.push_back(occupancy.getTileRows(tx, ty));
+                }
+            }
+        }
+
+        struct Payload {
+            Section section;
+            const void* data;  // nullptr: `blocks` (um bloco por vez)
+        };
+        std::vector<Payload> payloads;
+        payloads.push_back({{TILE_INDEX, (uint32_t)index.size(), 0, index.size() * sizeof(uint32_t)}, index.data()});
+        payloads.push_back({{TILE_BLOCKS, (uint32_t)blocks.size(), 0, blocks.size() * tileWords * sizeof(uint64_t)}, nullptr});
+        if (contents.labels) {
+            payloads.push_back({{REACHABILITY, (uint32_t)contents.labelCount, 0, cells * sizeof(int32_t)}, contents.labels});
+        }
+        if (contents.landmarks && contents.landmarkDistances && contents.landmarkCount > 0) {
+            uint32_t k = (uint32_t)contents.landmarkCount;
+            payloads.push_back({{LANDMARK_CELLS, k, 0, k * sizeof(Cell)}, contents.landmarks});
+            payloads.push_back({{LANDMARK_DISTANCES, k, 0, cells * k * sizeof(uint16_t)}, contents.landmarkDistances});
+        }
+
+        Header fileHeader = {};
+        std::memcpy(fileHeader.magic, MAGIC, sizeof(MAGIC));
+        fileHeader.byteOrder = BYTE_ORDER_MARK;
+        fileHeader.formatVersion = FORMAT_VERSION;
+        fileHeader.gridType = (uint32_t)contents.gridType;
+        fileHeader.width = width;
+        fileHeader.height = height;
+        fileHeader.tileShift = ObstacleBitGrid::TILE_SHIFT;
+        fileHeader.sectionCount = (uint32_t)payloads.size();
+
+        uint64_t offset = alignUp(sizeof(Header) + payloads.size() * sizeof(Section));
+        for (auto& payload : payloads) {
+            payload.section.offset = offset;
+            offset = alignUp(offset + payload.section.bytes);
+        }
+
+        // Grava num temporário e troca no fim: um erro no meio não estraga o mapa antigo
+        const std::string temporary = path + ".tmp";
+        {
+            std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+            if (!file) return fail(error, "nao foi possivel criar " + temporary);
+            static const char padding[ALIGNMENT] = {};
+            uint64_t written = 0;
+            auto write = [&file, &written](const void* data, uint64_t bytes) {
+                file.write(static_cast<const char*>(data), (std::streamsize)bytes);
+                written += bytes;
+            };
+            auto pad = [&](uint64_t to) { write(padding, to - written); };
+
+            write(&fileHeader, sizeof(fileHeader));
+            for (const auto& payload : payloads) write(&payload.section, sizeof(Section));
+            for (const auto& payload : payloads) {
+                pad(payload.section.offset);
+                if (payload.data) {
+                    write(payload.data, payload.section.bytes);
+                } else {
+                    for (const uint64_t* rows : blocks) write(rows, tileWords * sizeof(uint64_t));
+                }
+            }
+            pad(alignUp(written));
+            if (!file) {
+                file.close();
+                std::remove(temporary.c_str());
+                return fail(error, "erro de escrita em " + temporary);
+            }
+        }
+        if (!replaceFile(temporary, path)) {
+            std::remove(temporary.c_str());
+            return fail(error, "nao foi possivel renomear " + temporary);
+        }
+        return true;
+    }
+};
+
+#endif // MAP_FILE_H
@@ -0,0 +1,174 @@
+#ifndef OBSTACLE_BIT_GRID_H
+#define OBSTACLE_BIT_GRID_H
+
+#include <vector>
+#include <memory>
+#include <cstdint>
+#include <cstddef>
+
+// =============================================================================
+// ObstacleBitGrid — Obstáculos do mapa em bits, em tiles de 64×64 células
+// =============================================================================
+// Fonte única da walkability de um mapa: 1 bit por célula (1 = obstáculo).
+// O Grid legado e os adapters leem daqui, em vez de cada um manter o seu
+// vector<vector<bool>> por coluna e uma matriz de Node por célula.
+//
+// O mapa é dividido em tiles de 64×64; cada tile guarda uma palavra de 64
+// bits por linha. Mapas grandes (2000×2000 ou mais) costumam ser quase todos
+// livres ou quase todos parede, então:
+//   - tile uniforme (todo livre ou todo bloqueado) não ocupa memória própria:
+//     aponta para um de dois blocos estáticos compartilhados;
+//   - o tile só ganha bloco próprio quando uma célula dele difere do resto
+//     (alocação sob demanda) e volta a apontar para o bloco uniforme quando
+//     deixa de diferir;
+//   - cópias (GridSnapshot) compartilham os blocos e copiam só os ponteiros;
+//     set() duplica o bloco antes de escrever se ele estiver compartilhado
+//     (copy-on-write). A thread que lê uma cópia nunca vê a escrita.
+//
+// Testar uma célula é uma leitura na tabela de tiles, um shift e uma máscara.
+// Dados de busca (g, h, pai) não ficam aqui — cada motor tem seus buffers
+// por consulta (SearchSpace).
+// =============================================================================
+class ObstacleBitGrid {
+public:
+    static constexpr int TILE_SHIFT = 6;
+    static constexpr int TILE_SIZE = 1 << TILE_SHIFT;  // 64: uma palavra por linha do tile
+
+private:
+    struct Tile {
+        uint64_t rows[TILE_SIZE];
+    };
+
+    int width = 0;
+    int height = 0;
+    int tilesX = 0;
+    int tilesY = 0;
+    std::vector<std::shared_ptr<Tile>> tiles;  // Dono (ou coproprietário) dos blocos
+    std::vector<const uint64_t*> tileRows;     // tiles[t]->rows, sem passar pelo shared_ptr
+
+    static const std::shared_ptr<Tile>& uniformTile(bool blocked) {
+        static const std::shared_ptr<Tile> freeTile = makeUniform(0);
+        static const std::shared_ptr<Tile> blockedTile = makeUniform(~uint64_t(0));
+        return blocked ? blockedTile : freeTile;
+    }
+
+    static std::shared_ptr<Tile> makeUniform(uint64_t word) {
+        auto tile = std::make_shared<Tile>();
+        for (uint64_t& row : tile->rows) row = word;
+        return tile;
+    }
+
+    int tileOf(int x, int y) const { return (y >> TILE_SHIFT) * tilesX + (x >> TILE_SHIFT); }
+
+    void assign(int t, std::shared_ptr<Tile> tile) {
+        tileRows[t] = tile->rows;
+        tiles[t] = std::move(tile);
+    }
+
+    // Bits válidos de cada linha do tile (tiles da borda direita são parciais)
+    uint64_t columnMask(int t) const {
+        int columns = width - (t % tilesX) * TILE_SIZE;
+        return columns >= TILE_SIZE ? ~uint64_t(0) : (uint64_t(1) << columns) - 1;
+    }
+
+    int rowCount(int t) const {
+        int rows = height - (t / tilesX) * TILE_SIZE;
+        return rows < TILE_SIZE ? rows : TILE_SIZE;
+    }
+
+    // Se o tile ficou todo livre ou todo bloqueado, devolve o bloco próprio
+    void collapseIfUniform(int t) {
+        const uint64_t mask = columnMask(t);
+        const uint64_t* rows = tileRows[t];
+        uint64_t first = rows[0] & mask;
+        if (first != 0 && first != mask) return;
+        for (int r = 1, n = rowCount(t); r < n; ++r) {
+            if ((rows[r] & mask) != first) return;
+        }
+        assign(t, uniformTile(first != 0));
+    }
+
+public:
+    ObstacleBitGrid() = default;
+    ObstacleBitGrid(int w, int h)
+        : width(w), height(h),
+          tilesX((w + TILE_SIZE - 1) >> TILE_SHIFT), tilesY((h + TILE_SIZE - 1) >> TILE_SHIFT),
+          tiles((size_t)tilesX * tilesY, uniformTile(false)),
+          tileRows((size_t)tilesX * tilesY, uniformTile(false)->rows) {}
+
+    bool inBounds(int x, int y) const {
+        return x >= 0 && x < width && y >= 0 && y < height;
+    }
+
+    // O chamador garante (x, y) dentro do mapa
+    bool isBlocked(int x, int y) const {
+        return (tileRows[tileOf(x, y)][y & (TILE_SIZE - 1)] >> (x & (TILE_SIZE - 1))) & 1;
+    }
+
+    bool isWalkable(int x, int y) const {
+        return inBounds(x, y) && !isBlocked(x, y);
+    }
+
+    void set(int x, int y, bool blocked) {
+        if (!inBounds(x, y) || isBlocked(x, y) == blocked) return;
+        int t = tileOf(x, y);
+        // Bloco uniforme ou compartilhado com uma cópia: escreve numa cópia própria
+        if (tiles[t].use_count() > 1) {
+            assign(t, std::make_shared<Tile>(*tiles[t]));
+        }
+        uint64_t& row = tiles[t]->rows[y & (TILE_SIZE - 1)];
+        uint64_t bit = uint64_t(1) << (x & (TILE_SIZE - 1));
+        row = blocked ? (row | bit) : (row & ~bit);
+        collapseIfUniform(t);
+    }
+
+    // Todo o mapa livre (ou todo bloqueado) sem alocar nenhum tile
+    void fill(bool blocked) {
+        for (size_t t = 0; t < tiles.size(); ++t) {
+            assign((int)t, uniformTile(blocked));
+        }
+    }
+
+    // Tile (tx, ty) sem bloco próprio: todo livre ou todo bloqueado (`blocked`)
+    bool isUniformTile(int tx, int ty, bool& blocked) const {
+        const auto& tile = tiles[(size_t)ty * tilesX + tx];
+        blocked = tile == uniformTile(true);
+        return blocked || tile == uniformTile(false);
+    }
+
+    // Linhas do tile (tx, ty): TILE_SIZE palavras, bit x da palavra y = célula
+    // (tx * TILE_SIZE + x, ty * TILE_SIZE + y)
+    const uint64_t* getTileRows(int tx, int ty) const { return tileRows[(size_t)ty * tilesX + tx]; }
+
+    // Tile (tx, ty) passa a ler as linhas de `rows` (TILE_SIZE palavras, por
+    // exemplo dentro de um arquivo mapeado) sem copiá-las. `owner` mantém a
+    // memória viva enquanto algum tile apontar para ela. O ponteiro divide a
+    // contagem de `owner`: enquanto mais alguém usar a memória, set() copia o
+    // bloco antes de escrever; se só sobrou este tile, escreve no lugar — a
+    // memória precisa aceitar escrita (mapeamento privado, não o arquivo).
+    void shareTile(int tx, int ty, const std::shared_ptr<const void>& owner, const uint64_t* rows) {
+        std::shared_ptr<Tile> tile(std::const_pointer_cast<void>(owner),
+                                   reinterpret_cast<Tile*>(const_cast<uint64_t*>(rows)));
+        assign(ty * tilesX + tx, std::move(tile));
+    }
+
+    void setUniformTile(int tx, int ty, bool blocked) {
+        assign(ty * tilesX + tx, uniformTile(blocked));
+    }
+
+    int getWidth() const { return width; }
+    int getHeight() const { return height; }
+    int getTilesX() const { return tilesX; }
+    int getTilesY() const { return tilesY; }
+
+    // Tiles com bloco próprio (os demais são uniformes)
+    size_t getAllocatedTiles() const {
+        size_t count = 0;
+        for (const auto& tile : tiles) {
+            if (tile != uniformTile(false) && tile != uniformTile(true)) count++;
+        }
+        return count;
+    }
+};
+
+#endif // OBSTACLE_BIT_GRID_H
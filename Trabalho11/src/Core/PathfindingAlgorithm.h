@@ -0,0 +1,18 @@
+#ifndef PATHFINDING_ALGORITHM_H
+#define PATHFINDING_ALGORITHM_H
+
+// Algoritmos de busca disponíveis para o grid retangular
+enum class PathfindingAlgorithm {
+    ASTAR,
+    JPS
+};
+
+inline const char* toString(PathfindingAlgorithm algorithm) {
+    switch (algorithm) {
+        case PathfindingAlgorithm::JPS: return "JPS";
+        case PathfindingAlgorithm::ASTAR:
+        default: return "AStar";
+    }
+}
+
+#endif // PATHFINDING_ALGORITHM_H
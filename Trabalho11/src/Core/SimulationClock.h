@@ -0,0 +1,152 @@
+#ifndef SIMULATION_CLOCK_H
+#define SIMULATION_CLOCK_H
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+
+// =============================================================================
+// SimulationClock — Relógio de passo fixo, separado da taxa de desenho
+// =============================================================================
+// A simulação sempre avança em passos de `step` segundos (1/60 por padrão).
+// O tempo de cada frame desenhado entra num acumulador e vira 0..N passos;
+// o que sobra (menos de um passo) é a fração `alpha` usada para interpolar
+// as posições no desenho. Um frame lento não gera um salto maior: gera mais
+// passos do mesmo tamanho, e o resultado só depende do número de passos.
+//
+// Para não entrar em espiral (passos demorando mais que o tempo simulado),
+// o atraso acima de `maxCatchUpSteps` passos é descartado: a simulação fica
+// mais lenta que o relógio em vez de travar a janela.
+//
+// Modos (F6/F7 na aplicação):
+//   REAL_TIME   — passos conforme o tempo real (com acumulador)
+//   FIXED_STEPS — exatamente N passos por frame (acelera cenários leves)
+//   MAX_SPEED   — quantos passos couberem em `frameBudgetMs` por frame:
+//                 avanço rápido na vazão máxima com a janela respondendo
+// Pausado, nenhum passo roda e o desenho fica no último estado.
+// =============================================================================
+class SimulationClock {
+public:
+    enum class Mode { REAL_TIME, FIXED_STEPS, MAX_SPEED };
+    using StepFunction = std::function<void(float stepSeconds)>;
+
+private:
+    static constexpr int maxStepsPerFrame = 16;  // Último degrau antes de MAX_SPEED
+
+    float step;
+    double accumulator = 0.0;
+    float alpha = 1.0f;
+    Mode mode = Mode::REAL_TIME;
+    int stepsPerFrame = 1;       // Usado em FIXED_STEPS
+    bool paused = false;
+    int maxCatchUpSteps = 8;
+    double frameBudgetMs = 12.0;  // Usado em MAX_SPEED
+    int lastSteps = 0;
+    uint64_t totalSteps = 0;
+
+    void useFixedSteps(int steps) {
+        mode = Mode::FIXED_STEPS;
+        stepsPerFrame = steps;
+    }
+
+public:
+    explicit SimulationClock(float stepSeconds = 1.0f / 60.0f)
+        : step(stepSeconds > 0.0f ? stepSeconds : 1.0f / 60.0f) {}
+
+    // Chama advance(step) quantas vezes o modo pede para este frame e
+    // devolve quantos passos rodaram
+    int tick(float frameTime, const StepFunction& advance) {
+        lastSteps = 0;
+        if (paused) return 0;
+
+        switch (mode) {
+        case Mode::REAL_TIME:
+            accumulator += std::max(0.0f, frameTime);
+            accumulator = std::min(accumulator, (double)step * maxCatchUpSteps);
+            while (accumulator >= step) {
+                advance(step);
+                accumulator -= step;
+                lastSteps++;
+            }
+            alpha = (float)(accumulator / step);
+            break;
+
+        case Mode::FIXED_STEPS:
+            for (int i = 0; i < stepsPerFrame; ++i) {
+                advance(step);
+                lastSteps++;
+            }
+            accumulator = 0.0;
+            alpha = 1.0f;
+            break;
+
+        case Mode::MAX_SPEED: {
+            auto start = std::chrono::steady_clock::now();
+            do {
+                advance(step);
+                lastSteps++;
+            } while (std::chrono::duration<double, std::milli>(
+                         std::chrono::steady_clock::now() - start).count() < frameBudgetMs);
+            accumulator = 0.0;
+            alpha = 1.0f;
+            break;
+        }
+        }
+
+        totalSteps += lastSteps;
+        return lastSteps;
+    }
+
+    // Degraus: tempo real → 2, 4, ... 16 passos/frame → máximo
+    void speedUp() {
+        if (mode == Mode::REAL_TIME) {
+            useFixedSteps(2);
+        } else if (mode == Mode::FIXED_STEPS && stepsPerFrame < maxStepsPerFrame) {
+            useFixedSteps(stepsPerFrame * 2);
+        } else {
+            mode = Mode::MAX_SPEED;
+        }
+    }
+
+    void slowDown() {
+        if (mode == Mode::MAX_SPEED) {
+            useFixedSteps(maxStepsPerFrame);
+        } else if (mode == Mode::FIXED_STEPS && stepsPerFrame > 2) {
+            useFixedSteps(stepsPerFrame / 2);
+        } else {
+            setRealTime();
+        }
+    }
+
+    void setRealTime() {
+        mode = Mode::REAL_TIME;
+        accumulator = 0.0;
+    }
+
+    // N passos por frame, independente do tempo real; 0 = pausa
+    void setStepsPerFrame(int steps) {
+        paused = steps <= 0;
+        if (!paused) useFixedSteps(steps);
+    }
+
+    void setMaxSpeed(double budgetMs) {
+        mode = Mode::MAX_SPEED;
+        frameBudgetMs = std::max(1.0, budgetMs);
+    }
+
+    void setPaused(bool value) { paused = value; }
+    void togglePaused() { paused = !paused; }
+    bool isPaused() const { return paused; }
+
+    Mode getMode() const { return mode; }
+    int getStepsPerFrame() const { return stepsPerFrame; }
+    float getStep() const { return step; }
+    // Fração do passo já decorrida, para interpolar o desenho
+    float getAlpha() const { return alpha; }
+    int getLastSteps() const { return lastSteps; }
+    uint64_t getTotalSteps() const { return totalSteps; }
+    double getSimulatedSeconds() const { return totalSteps * (double)step; }
+};
+
+#endif // SIMULATION_CLOCK_H
@@ -2,12 +2,22 @@
 #define CONCRETE_ASTAR_ALGORITHM_FACTORY_H
 
 #include "src/Interfaces/IAlgorithmFactory.h"
+#include "src/Core/PathfindingAlgorithm.h"
 #include "Adapters/AStarAdapter.h"
+#include "Adapters/JPSAdapter.h"
 #include "Adapters/LocationProvider.h"
 
 class AStarAlgorithmFactory : public IAlgorithmFactory {
+private:
+    PathfindingAlgorithm algorithm;
+
 public:
+    AStarAlgorithmFactory(PathfindingAlgorithm algo = PathfindingAlgorithm::ASTAR) : algorithm(algo) {}
+
     std::unique_ptr<IAlgorithm> CreateAlgorithm() override {
+        if (algorithm == PathfindingAlgorithm::JPS) {
+            return std::make_unique<JPSAdapter>();
+        }
         return std::make_unique<AStarAdapter>();
     }
 
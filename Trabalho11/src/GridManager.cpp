@@ -1,6 +1,7 @@
 #include "GridManager.h"
 #include "Adapters/RectangularGridAdapter.h"
 #include "Adapters/HexagonalGridAdapter.h"
+#include "Observer/GridChangeNotifier.h"
 #include <cmath>
 
 GridManager* GridManager::instance = nullptr;
@@ -17,28 +18,51 @@ void GridManager::init(std::unique_ptr<IAppFactory> appFactory, GridType initial
     switchGrid(initialGridType, width, height);
 }
 
-void GridManager::switchGrid(GridType type, int width, int height) {
-    if (type == GridType::RECTANGULAR) {
-        grid = std::make_unique<RectangularGridAdapter>(width, height);
-    } else if (type == GridType::HEXAGONAL) {
-        // Calcula dimensões para preencher a tela
+void GridManager::gridSizeFor(GridType type, float pixelWidth, float pixelHeight, int& cols, int& rows) {
+    if (type == GridType::HEXAGONAL) {
         // Para hexágonos pointy-top com raio 12:
         // horizSpacing = sqrt(3) * 12 ≈ 20.78
         // vertSpacing = 12 * 2 * 0.75 = 18
         float hexRadius = 12.0f;
         float horizSpacing = std::sqrt(3.0f) * hexRadius;
         float vertSpacing = hexRadius * 2.0f * 0.75f;
-        
-        // screenWidth e screenHeight são passados como width/cellSize e height/cellSize
-        // então precisamos recalcular para pixels (800x600)
-        int screenWidth = 800;
-        int screenHeight = 600;
-        
-        int cols = (int)(screenWidth / horizSpacing) + 1;
-        int rows = (int)(screenHeight / vertSpacing) + 1;
-        
+        cols = (int)(pixelWidth / horizSpacing) + 1;
+        rows = (int)(pixelHeight / vertSpacing) + 1;
+    } else {
+        float cellSize = 20.0f;
+        cols = (int)(pixelWidth / cellSize);
+        rows = (int)(pixelHeight / cellSize);
+    }
+}
+
+void GridManager::switchGrid(GridType type, int cols, int rows) {
+    // A versão do mapa novo continua a do anterior (nunca volta a 0)
+    uint64_t previousVersion = grid ? grid->getJournal().getVersion() : 0;
+    IGridAdapter* previous = grid.get();
+
+    if (type == GridType::RECTANGULAR) {
+        grid = std::make_unique<RectangularGridAdapter>(cols, rows);
+    } else if (type == GridType::HEXAGONAL) {
         grid = std::make_unique<HexagonalGridAdapter>(cols, rows);
     }
+
+    if (grid) {
+        grid->getJournal().rebase(previousVersion + 1);
+        GridChangeNotifier::getInstance()->gridReplaced(previous, grid.get());
+    }
+}
+
+bool GridManager::loadGrid(const MapFile& map) {
+    ObstacleBitGrid occupancy;
+    if (!map.isOpen() || !map.readOccupancy(occupancy)) return false;
+
+    switchGrid(map.getGridType(), map.getWidth(), map.getHeight());
+    if (!grid) return false;
+    bool loaded = false;
+    GridChangeNotifier::getInstance()->bulkEdit(grid.get(), [this, &occupancy, &loaded]() {
+        loaded = grid->replaceOccupancy(occupancy);
+    });
+    return loaded;
 }
 
 IGridAdapter* GridManager::getGrid() {
@@ -4,6 +4,7 @@
 #include "../src/Interfaces/IGridAdapter.h"
 #include "../src/Interfaces/IAppFactory.h"
 #include "../src/Core/GridType.h"
+#include "../src/Core/MapFile.h"
 #include <memory>
 
 class GridManager {
@@ -20,7 +21,13 @@ public:
 
     static GridManager* getInstance();
     void init(std::unique_ptr<IAppFactory> appFactory, GridType initialGridType, int width, int height);
-    void switchGrid(GridType type, int width, int height);
+    // Dimensões em células (colunas × linhas), sem relação com a janela
+    void switchGrid(GridType type, int cols, int rows);
+    // Quantas células de cada tipo cobrem uma área de pixelWidth × pixelHeight
+    static void gridSizeFor(GridType type, float pixelWidth, float pixelHeight, int& cols, int& rows);
+    // Troca o grid pelo do arquivo (tipo, dimensões e obstáculos, sem copiar
+    // os tiles). Falha sem mexer no grid atual se o arquivo estiver corrompido
+    bool loadGrid(const MapFile& map);
     IGridAdapter* getGrid();
     IAppFactory* getAppFactory(); // New method to get the app factory
 };
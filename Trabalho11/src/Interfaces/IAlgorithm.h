@@ -4,12 +4,17 @@
 #include "Trabalho9_Legacy.h"
 #include "src/Interfaces/IGrid.h"
 #include <vector>
+#include <string>
 
 class IAlgorithm {
 public:
     virtual ~IAlgorithm() = default;
-    virtual std::vector<Vector2> FindPath(IGrid* grid, Vector2 start, Vector2 end) = 0;
+    // `landmarks`: heurística ALT da busca (nullptr = heurística base)
+    virtual std::vector<Vector2> FindPath(IGrid* grid, Vector2 start, Vector2 end,
+                                          const LandmarkTable* landmarks = nullptr) = 0;
     virtual double GetLastExecutionTime() const = 0;
+    virtual int GetLastExpandedNodes() const = 0;
+    virtual std::string GetName() const = 0;
 };
 
 #endif // IALGORITHM_H
@@ -4,6 +4,8 @@
 #include "IGrid.h"
 #include "../Core/Cell.h"
 #include "../Core/GridType.h"
+#include "../Core/ObstacleBitGrid.h"
+#include "../Core/GridChangeJournal.h"
 #include <vector>
 #include <list>
 
@@ -26,6 +28,27 @@ public:
     virtual std::list<Cell> getNeighbors(Cell cell) const = 0;
     virtual bool isValidCoordinate(int x, int y) const = 0;
     virtual Cell getCell(int x, int y) const = 0;
+
+    // Bits de obstáculo do mapa (fonte única, a mesma lida pelo Grid legado).
+    // Motores de busca guardam a referência e testam células sem chamada virtual.
+    virtual const ObstacleBitGrid& getOccupancy() const = 0;
+
+    // Troca todos os obstáculos por `source` (mesmas dimensões) sem passar
+    // célula a célula — carregar mapa. Registra o mapa inteiro no diário.
+    virtual bool replaceOccupancy(const ObstacleBitGrid& source) = 0;
+
+    // Tamanho do mapa em pixels — independe da janela; a câmera da aplicação
+    // decide qual parte aparece
+    virtual Vector2 getWorldSize() const = 0;
+
+    // Desenha só as células que cruzam `worldArea` (área visível da câmera,
+    // em pixels do mundo). Draw() equivale a DrawArea do mapa inteiro.
+    virtual void DrawArea(Rectangle worldArea) = 0;
+
+    // Diário de alterações: versão do mapa e células/regiões alteradas.
+    // SetObstacle registra nele toda célula que mudou de estado.
+    virtual GridChangeJournal& getJournal() = 0;
+    virtual const GridChangeJournal& getJournal() const = 0;
 };
 
 #endif // IGRID_ADAPTER_H
@@ -0,0 +1,192 @@
+#ifndef AGENT_STORE_H
+#define AGENT_STORE_H
+
+#include "raylib.h"
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <cmath>
+
+class GameAgent;
+
+// =============================================================================
+// AgentStore — Dados quentes dos agentes em arrays contíguos (SoA)
+// =============================================================================
+// Cada agente ocupa um slot: o índice dele em todos os arrays abaixo. O laço
+// de atualização, a sincronização com a evasão e o desenho percorrem os
+// arrays em sequência, sem seguir um ponteiro por agente.
+//
+// O GameAgent vira um handle: guarda o slot e os dados frios (observers,
+// caminho completo, flow field, D* Lite). Do caminho, o store só guarda o
+// cursor (índice e tamanho) e a célula do waypoint atual, então seguir o
+// caminho não toca no handle; ele só é consultado ao trocar de waypoint.
+//
+// Os slots seguem a ordem de criação. remove() preserva a ordem dos demais
+// (as métricas e a evasão dependem dela); o dono renumera os handles.
+// Remover o último slot é O(1).
+//
+// A simulação anda em passos fixos e o desenho acontece entre dois passos:
+// beginStep() guarda as posições do passo anterior e o desenho interpola
+// entre elas e as atuais (getInterpolatedPosition).
+// =============================================================================
+class AgentStore {
+public:
+    enum Flag : uint8_t {
+        ALIVE = 1,
+        HAS_PATH = 2,
+        REACHED_TARGET = 4
+    };
+
+private:
+    std::vector<Vector2> position;
+    std::vector<Vector2> previousPosition;  // Posição no início do passo atual
+    std::vector<Vector2> velocity;       // Deslocamento aplicado no último passo
+    std::vector<float> speed;
+    std::vector<Vector2> waypoint;       // Célula path[pathIndex] (válida se pathIndex < pathLength)
+    std::vector<int32_t> pathIndex;
+    std::vector<int32_t> pathLength;
+    std::vector<uint8_t> flags;
+    std::vector<float> distanceTraveled;
+    std::vector<Color> color;
+    std::vector<int32_t> health;
+    std::vector<int32_t> maxHealth;
+    std::vector<GameAgent*> handle;
+    uint64_t revision = 0;  // Muda quando posições, agentes ativos ou slots mudam
+
+    template <typename T>
+    static void eraseAt(std::vector<T>& values, uint32_t slot) {
+        values.erase(values.begin() + slot);
+    }
+
+public:
+    uint32_t add(GameAgent* owner, Vector2 pos, float agentSpeed, int hp, Color agentColor) {
+        position.push_back(pos);
+        previousPosition.push_back(pos);
+        velocity.push_back({0.0f, 0.0f});
+        speed.push_back(agentSpeed);
+        waypoint.push_back({0.0f, 0.0f});
+        pathIndex.push_back(0);
+        pathLength.push_back(0);
+        flags.push_back(ALIVE);
+        distanceTraveled.push_back(0.0f);
+        color.push_back(agentColor);
+        health.push_back(hp);
+        maxHealth.push_back(hp);
+        handle.push_back(owner);
+        revision++;
+        return (uint32_t)(handle.size() - 1);
+    }
+
+    // Os slots seguintes descem uma posição
+    void remove(uint32_t slot) {
+        eraseAt(position, slot);
+        eraseAt(previousPosition, slot);
+        eraseAt(velocity, slot);
+        eraseAt(speed, slot);
+        eraseAt(waypoint, slot);
+        eraseAt(pathIndex, slot);
+        eraseAt(pathLength, slot);
+        eraseAt(flags, slot);
+        eraseAt(distanceTraveled, slot);
+        eraseAt(color, slot);
+        eraseAt(health, slot);
+        eraseAt(maxHealth, slot);
+        eraseAt(handle, slot);
+        revision++;
+    }
+
+    void reserve(size_t count) {
+        position.reserve(count);
+        previousPosition.reserve(count);
+        velocity.reserve(count);
+        speed.reserve(count);
+        waypoint.reserve(count);
+        pathIndex.reserve(count);
+        pathLength.reserve(count);
+        flags.reserve(count);
+        distanceTraveled.reserve(count);
+        color.reserve(count);
+        health.reserve(count);
+        maxHealth.reserve(count);
+        handle.reserve(count);
+    }
+
+    size_t size() const { return handle.size(); }
+    
+    // Índices derivados das posições (SpatialHash) comparam a revisão para
+    // saber se ainda valem
+    uint64_t getRevision() const { return revision; }
+    GameAgent* getHandle(uint32_t slot) const { return handle[slot]; }
+
+    // Estado
+    bool has(uint32_t slot, Flag flag) const { return (flags[slot] & flag) != 0; }
+    void set(uint32_t slot, Flag flag, bool value) {
+        flags[slot] = (uint8_t)(value ? (flags[slot] | flag) : (flags[slot] & ~flag));
+        if (flag != HAS_PATH) revision++;  // Só vivo/chegou mudam quem está ativo
+    }
+    // Vivo e ainda a caminho do destino
+    bool isActive(uint32_t slot) const { return (flags[slot] & (ALIVE | REACHED_TARGET)) == ALIVE; }
+
+    // Movimento
+    Vector2 getPosition(uint32_t slot) const { return position[slot]; }
+    const std::vector<Vector2>& getPositions() const { return position; }
+    Vector2 getVelocity(uint32_t slot) const { return velocity[slot]; }
+    float getSpeed(uint32_t slot) const { return speed[slot]; }
+    void setSpeed(uint32_t slot, float value) { speed[slot] = value; }
+
+    // Teleporte: não conta como distância percorrida nem é interpolado
+    void setPosition(uint32_t slot, Vector2 pos) {
+        position[slot] = pos;
+        previousPosition[slot] = pos;
+        revision++;
+    }
+    
+    // Início de um passo da simulação: as posições atuais viram as anteriores
+    void beginStep() { previousPosition = position; }
+    
+    // Posição para desenho, `alpha` ∈ [0, 1] entre o passo anterior e o atual
+    Vector2 getInterpolatedPosition(uint32_t slot, float alpha) const {
+        Vector2 from = previousPosition[slot];
+        Vector2 to = position[slot];
+        return {from.x + (to.x - from.x) * alpha, from.y + (to.y - from.y) * alpha};
+    }
+
+    // Deslocamento normal: acumula a distância percorrida (métricas)
+    void moveTo(uint32_t slot, Vector2 pos) {
+        integrate(slot, pos);
+        revision++;
+    }
+
+    // moveTo() para laços paralelos: cada thread escreve só nos seus slots e
+    // a revisão (compartilhada) não muda; chame touch() depois da barreira
+    void integrate(uint32_t slot, Vector2 pos) {
+        float dx = pos.x - position[slot].x;
+        float dy = pos.y - position[slot].y;
+        distanceTraveled[slot] += std::sqrt(dx * dx + dy * dy);
+        velocity[slot] = {dx, dy};
+        position[slot] = pos;
+    }
+
+    void touch() { revision++; }
+
+    float getDistanceTraveled(uint32_t slot) const { return distanceTraveled[slot]; }
+    void setDistanceTraveled(uint32_t slot, float value) { distanceTraveled[slot] = value; }
+
+    // Cursor do caminho
+    int getPathIndex(uint32_t slot) const { return pathIndex[slot]; }
+    int getPathLength(uint32_t slot) const { return pathLength[slot]; }
+    Vector2 getWaypoint(uint32_t slot) const { return waypoint[slot]; }
+    void setPathCursor(uint32_t slot, int index, int length, Vector2 cell) {
+        pathIndex[slot] = index;
+        pathLength[slot] = length;
+        waypoint[slot] = cell;
+    }
+
+    // Aparência e vida
+    Color getColor(uint32_t slot) const { return color[slot]; }
+    int getHealth(uint32_t slot) const { return health[slot]; }
+    void setHealth(uint32_t slot, int value) { health[slot] = value; }
+    int getMaxHealth(uint32_t slot) const { return maxHealth[slot]; }
+};
+
+#endif // AGENT_STORE_H
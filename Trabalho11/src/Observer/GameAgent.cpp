@@ -3,9 +3,10 @@
 #include <cmath>
 
 void GameAgent::update(Grid& grid, float deltaTime) {
-    if (!alive) return;
+    if (!isAlive()) return;
     
-    if (!hasPath) {
+    Vector2 position = getPosition();
+    if (!getHasPath()) {
         // Tenta encontrar caminho
         Vector2 gridPos = {position.x / grid.GetCellSize(), position.y / grid.GetCellSize()};
         auto newPath = Pathfinder::FindPath(grid, gridPos, target, "random");
@@ -19,6 +20,7 @@ void GameAgent::update(Grid& grid, float deltaTime) {
         return;
     }
     
+    int currentPathIndex = getCurrentPathIndex();
     if (currentPathIndex < (int)path.size()) {
         Vector2 nextCell = path[currentPathIndex];
         Vector2 targetWorldPos = {
@@ -30,32 +32,35 @@ void GameAgent::update(Grid& grid, float deltaTime) {
         float distance = std::sqrt(direction.x * direction.x + direction.y * direction.y);
         
         if (distance < 5.0f) {
-            currentPathIndex++;
+            setCurrentPathIndex(currentPathIndex + 1);
         } else {
             direction.x /= distance;
             direction.y /= distance;
             
             Vector2 oldPos = position;
-            position.x += direction.x * speed * deltaTime * 60.0f;
-            position.y += direction.y * speed * deltaTime * 60.0f;
+            float speed = getSpeed();
+            store->setPosition(slot, {position.x + direction.x * speed * deltaTime * 60.0f,
+                                      position.y + direction.y * speed * deltaTime * 60.0f});
             notifyObservers(AgentEvents::AGENT_MOVED, &oldPos);
         }
     } else {
-        hasPath = false;
+        setHasPath(false);
         reachTarget();
     }
 }
 
 void GameAgent::draw(float cellSize) {
-    if (!alive) return;
+    if (!isAlive()) return;
     
+    Vector2 position = getPosition();
+    Color color = getColor();
     // Desenha o agente
     DrawCircle(position.x, position.y, cellSize / 3, color);
     
     // Desenha barra de vida
     float healthBarWidth = cellSize;
     float healthBarHeight = 4;
-    float healthPercent = (float)health / maxHealth;
+    float healthPercent = (float)getHealth() / getMaxHealth();
     
     DrawRectangle(
         position.x - healthBarWidth / 2, 
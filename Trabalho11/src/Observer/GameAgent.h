@@ -2,11 +2,15 @@
 #define GAME_AGENT_H
 
 #include "src/Interfaces/IObserver.h"
+#include "AgentStore.h"
+#include "src/Pathfinding/DStarLite.h"
 #include "raylib.h"
 #include <vector>
 #include <algorithm>
 #include <string>
 #include <cmath>
+#include <memory>
+#include <cstdint>
 
 // Eventos do agente
 namespace AgentEvents {
@@ -20,41 +24,54 @@ namespace AgentEvents {
 
 // Forward declarations
 class Grid;
+class FlowField;
 
 // Agente com suporte ao padrão Observer (Subject)
+// Handle sobre um slot do AgentStore: posição, velocidade, cursor do caminho,
+// estado e vida ficam nos arrays do store; aqui ficam só os dados frios.
+// O endereço do handle é a identidade do agente (observers, tickets de busca,
+// planos cooperativos), por isso ele não é copiável.
 class GameAgent : public ISubject {
 private:
+    AgentStore* store;
+    uint32_t slot;
+    
     std::vector<IObserver*> observers;
     
-    Vector2 position;
     Vector2 spawnPosition;
     Vector2 target;
     std::vector<Vector2> path;
-    int currentPathIndex;
-    bool hasPath;
-    bool reachedTarget;
-    Color color;
-    float speed;
-    int health;
-    int maxHealth;
-    bool alive;
+    FlowField* flowField = nullptr;  // Campo compartilhado (navegação por flow field)
+    std::unique_ptr<DStarLite> planner;  // Estado do replanejamento incremental (D* Lite)
+    uint64_t blockedVersion = UINT64_MAX; // Versão do mapa em que o alvo se mostrou inalcançável
     
-    // Métricas de distância para análise de desempenho
-    float totalDistanceTraveled = 0.0f;  // Distância real percorrida
-    float idealDistance = 0.0f;           // Distância em linha reta spawn→target (calculada uma vez)
+    // Distância em linha reta spawn→target (calculada uma vez, para métricas)
+    float idealDistance = 0.0f;
+
+    // Mantém o waypoint do store igual a path[index]
+    void syncPathCursor(int index) {
+        Vector2 cell = index >= 0 && index < (int)path.size() ? path[index] : Vector2{0.0f, 0.0f};
+        store->setPathCursor(slot, index, (int)path.size(), cell);
+    }
 
 public:
-    GameAgent(Vector2 start, Vector2 targetPos, int hp = 100) 
-        : position(start), spawnPosition(start), target(targetPos),
-          currentPathIndex(0), hasPath(false), reachedTarget(false),
-          color(GetRandomAgentColor()), speed(2.0f),
-          health(hp), maxHealth(hp), alive(true) {
-        // Calcula distância ideal (linha reta) entre spawn e target
-        // Nota: target aqui é em coordenadas de grid, então a distância ideal
-        // será recalculada quando o targetWorldPos for conhecido
-        idealDistance = 0.0f;
-        totalDistanceTraveled = 0.0f;
+    // Nota: target é em coordenadas de grid; a distância ideal é calculada
+    // depois (calculateIdealDistances), quando a posição do alvo no mundo é conhecida
+    GameAgent(AgentStore& agentStore, Vector2 start, Vector2 targetPos, int hp = 100)
+        : store(&agentStore), spawnPosition(start), target(targetPos) {
+        slot = store->add(this, start, 2.0f, hp, GetRandomAgentColor());
+    }
+    
+    // Libera o slot; os agentes seguintes descem uma posição
+    ~GameAgent() {
+        store->remove(slot);
+        for (uint32_t i = slot; i < store->size(); ++i) {
+            store->getHandle(i)->slot = i;
+        }
     }
+    
+    GameAgent(const GameAgent&) = delete;
+    GameAgent& operator=(const GameAgent&) = delete;
 
     // Implementação de ISubject
     void addObserver(IObserver* observer) override {
@@ -74,80 +91,84 @@ public:
         }
     }
 
+    // Slot no AgentStore (muda quando um agente anterior é removido)
+    uint32_t getSlot() const { return slot; }
+
     // Getters e Setters
-    Vector2 getPosition() const { return position; }
+    Vector2 getPosition() const { return store->getPosition(slot); }
     Vector2 getSpawnPosition() const { return spawnPosition; }
     Vector2 getTarget() const { return target; }
-    int getHealth() const { return health; }
-    int getMaxHealth() const { return maxHealth; }
-    bool isAlive() const { return alive; }
-    float getSpeed() const { return speed; }
-    Color getColor() const { return color; }
-    bool getHasPath() const { return hasPath; }
-    bool hasReachedTarget() const { return reachedTarget; }
+    int getHealth() const { return store->getHealth(slot); }
+    int getMaxHealth() const { return store->getMaxHealth(slot); }
+    bool isAlive() const { return store->has(slot, AgentStore::ALIVE); }
+    float getSpeed() const { return store->getSpeed(slot); }
+    Color getColor() const { return store->getColor(slot); }
+    bool getHasPath() const { return store->has(slot, AgentStore::HAS_PATH); }
+    bool hasReachedTarget() const { return store->has(slot, AgentStore::REACHED_TARGET); }
     const std::vector<Vector2>& getPath() const { return path; }
-    int getCurrentPathIndex() const { return currentPathIndex; }
+    int getCurrentPathIndex() const { return store->getPathIndex(slot); }
     
     // Métricas de distância
-    float getTotalDistanceTraveled() const { return totalDistanceTraveled; }
+    float getTotalDistanceTraveled() const { return store->getDistanceTraveled(slot); }
     float getIdealDistance() const { return idealDistance; }
-    float getExtraDistance() const { return std::max(0.0f, totalDistanceTraveled - idealDistance); }
+    float getExtraDistance() const { return std::max(0.0f, getTotalDistanceTraveled() - idealDistance); }
     void setIdealDistance(float d) { idealDistance = d; }
-    void resetDistanceMetrics() { totalDistanceTraveled = 0.0f; }
-
-    void setPosition(Vector2 pos) {
-        // Acumula distância percorrida para métricas
-        float dx = pos.x - position.x;
-        float dy = pos.y - position.y;
-        totalDistanceTraveled += std::sqrt(dx * dx + dy * dy);
-        position = pos;
-    }
+    void resetDistanceMetrics() { store->setDistanceTraveled(slot, 0.0f); }
+
+    // Acumula a distância percorrida para métricas
+    void setPosition(Vector2 pos) { store->moveTo(slot, pos); }
 
     void setTarget(Vector2 t) { target = t; }
     void setPath(const std::vector<Vector2>& p) { 
         path = p; 
-        hasPath = !path.empty();
-        currentPathIndex = 0;
+        store->set(slot, AgentStore::HAS_PATH, !path.empty());
+        syncPathCursor(0);
     }
-    void setHasPath(bool hp) { hasPath = hp; }
-    void setCurrentPathIndex(int idx) { currentPathIndex = idx; }
-    void setSpeed(float s) { speed = s; }
+    void setHasPath(bool hp) { store->set(slot, AgentStore::HAS_PATH, hp); }
+    void setCurrentPathIndex(int idx) { syncPathCursor(idx); }
+    void setSpeed(float s) { store->setSpeed(slot, s); }
+    FlowField* getFlowField() const { return flowField; }
+    void setFlowField(FlowField* field) { flowField = field; }
+    DStarLite* getPlanner() const { return planner.get(); }
+    uint64_t getBlockedVersion() const { return blockedVersion; }
+    void setBlockedVersion(uint64_t v) { blockedVersion = v; }
+    void setPlanner(std::unique_ptr<DStarLite> p) { planner = std::move(p); }
 
     // Dano e morte
     void takeDamage(int damage) {
-        if (!alive) return;
+        if (!isAlive()) return;
         
-        int oldHealth = health;
-        health = std::max(0, health - damage);
+        int oldHealth = getHealth();
+        store->setHealth(slot, std::max(0, oldHealth - damage));
         notifyObservers(AgentEvents::AGENT_HEALTH_CHANGED, &oldHealth);
         
-        if (health <= 0) {
+        if (getHealth() <= 0) {
             die();
         }
     }
 
     void die() {
-        if (!alive) return;
-        alive = false;
+        if (!isAlive()) return;
+        store->set(slot, AgentStore::ALIVE, false);
         notifyObservers(AgentEvents::AGENT_DIED, this);
     }
 
     // Respawn no ponto de origem
     void respawn() {
-        position = spawnPosition;
-        health = maxHealth;
-        alive = true;
-        hasPath = false;
-        reachedTarget = false;
-        currentPathIndex = 0;
+        store->setPosition(slot, spawnPosition);
+        store->setHealth(slot, getMaxHealth());
+        store->set(slot, AgentStore::ALIVE, true);
+        store->set(slot, AgentStore::HAS_PATH, false);
+        store->set(slot, AgentStore::REACHED_TARGET, false);
         path.clear();
+        syncPathCursor(0);
         notifyObservers(AgentEvents::AGENT_SPAWNED, this);
     }
 
     // Chegou ao destino
     void reachTarget() {
-        if (!reachedTarget) {
-            reachedTarget = true;
+        if (!hasReachedTarget()) {
+            store->set(slot, AgentStore::REACHED_TARGET, true);
             notifyObservers(AgentEvents::AGENT_REACHED_TARGET, this);
         }
     }
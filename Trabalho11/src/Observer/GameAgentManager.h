@@ -7,10 +7,28 @@
 #include "GameStatisticsObserver.h"
 #include "Trabalho9_Legacy.h"
 #include "src/Interfaces/IGridAdapter.h"
+#include "src/Interfaces/IAlgorithm.h"
 #include "src/Adapters/HexagonalGridAdapter.h"
 #include "src/Collision/CollisionManager.h"
 #include "src/Collision/CollisionObserver.h"
 #include "src/Collision/ICollisionAvoidance.h"
+#include "src/Collision/SpatialHash.h"
+#include "src/Observer/GridChangeNotifier.h"
+#include "src/Pathfinding/HierarchicalPathfinder.h"
+#include "src/Pathfinding/FlowFieldCache.h"
+#include "src/Pathfinding/PathCache.h"
+#include "src/Pathfinding/PathfindingService.h"
+#include "src/Pathfinding/PathfindingScheduler.h"
+#include "src/Pathfinding/DStarLite.h"
+#include "src/Pathfinding/ReachabilityIndex.h"
+#include "src/Pathfinding/LandmarkHeuristic.h"
+#include "src/Pathfinding/PathSmoother.h"
+#include "src/Pathfinding/CooperativePlanner.h"
+#include "src/Pathfinding/BatchPathfinder.h"
+#include "src/Observer/GridChangeCollector.h"
+#include "src/Core/MapFile.h"
+#include "src/Core/JobSystem.h"
+#include "src/Core/PathfindingAlgorithm.h"
 #include "Core/GridType.h"
 #include <vector>
 #include <memory>
@@ -18,11 +36,24 @@
 #include <cmath>
 #include <chrono>
 #include <set>
+#include <string>
+#include <unordered_map>
 
 // Gerenciador de agentes do jogo com suporte a Observer e diferentes tipos de grid
 class GameAgentManager {
 private:
+    // Dados quentes dos agentes em arrays contíguos; `agents` são os handles,
+    // na mesma ordem dos slots. O store é declarado antes para ser destruído
+    // depois dos handles (cada um libera o seu slot).
+    AgentStore store;
     std::vector<std::unique_ptr<GameAgent>> agents;
+    
+    // Índice espacial das posições (broadphase) compartilhado pela evasão,
+    // pela detecção/contagem de colisões e pelo desenho. Só é refeito quando
+    // o store mudou ou o conjunto de slots pedido é outro.
+    SpatialHash proximity;
+    std::vector<uint32_t> proximitySlots;     // Slot de cada ponto do índice
+    uint64_t proximityRevision = UINT64_MAX;  // Revisão do store na construção
     IGridAdapter* gridAdapter;
     GridType gridType;
     
@@ -39,6 +70,62 @@ private:
     std::unique_ptr<ICollisionAvoidance> collisionAvoidance;
     bool collisionAvoidanceEnabled = false;
     
+    // Strategy de busca de caminho no grid retangular (A*, JPS...)
+    // Se nulo, usa o Pathfinder legado com A*
+    std::unique_ptr<IAlgorithm> pathAlgorithm;
+    PathfindingAlgorithm pathAlgorithmKind = PathfindingAlgorithm::ASTAR;
+    
+    // HPA* (funciona nos dois tipos de grid); observa o GridChangeNotifier
+    std::unique_ptr<HierarchicalPathfinder> hierarchicalPathfinder;
+    
+    // Navegação por flow field: um campo por destino, compartilhado pelos agentes
+    std::unique_ptr<FlowFieldCache> flowFieldCache;
+    
+    // Cache LRU de caminhos na frente do Pathfinder/FindPathHex
+    std::unique_ptr<PathCache> pathCache;
+    
+    // Buscas assíncronas: agentes aguardam parados até o resultado ser entregue
+    std::unique_ptr<PathfindingService> pathService;
+    std::unordered_map<GameAgent*, uint64_t> pendingPathTickets;
+    std::unordered_map<uint64_t, GameAgent*> pendingPathAgents;
+    
+    // Buscas fatiadas com orçamento por frame (alternativa ao pool de threads;
+    // compartilha os mapas de requisições pendentes acima)
+    std::unique_ptr<PathfindingScheduler> pathScheduler;
+    
+    // Replanejamento incremental: cada agente tem seu D* Lite; as células
+    // alteradas são coletadas e repassadas aos planejadores uma vez por frame
+    std::unique_ptr<GridChangeCollector> replanChanges;
+    
+    // Componentes conexas: rejeita em O(1) buscas para alvos inalcançáveis
+    std::unique_ptr<ReachabilityIndex> reachability;
+    
+    // Heurística ALT (landmarks) para o A*/JPS retangular e o A* hexagonal
+    std::unique_ptr<LandmarkHeuristic> landmarks;
+    // Tabela de landmarks que veio com o mapa carregado (MapFile)
+    std::shared_ptr<const LandmarkTable> precomputedLandmarks;
+    
+    // Caminhos any-angle: só os cantos viram waypoints
+    bool pathSmoothing = false;
+    
+    // Busca cooperativa (WHCA*): planos espaço-tempo sem conflito entre agentes
+    std::unique_ptr<CooperativePlanner> cooperativePlanner;
+    std::unordered_map<GameAgent*, int> cooperativeIds;
+    
+    // Área do mundo visível na câmera (prioridade das buscas fatiadas);
+    // largura 0 = sem câmera, tudo visível
+    Rectangle viewport = {0.0f, 0.0f, 0.0f, 0.0f};
+    
+    // Threads da atualização: laços paralelos por blocos de slots, com os
+    // efeitos compartilhados (buscas, observers) num passo serial depois.
+    // Criado no primeiro uso; 0 = uma thread por núcleo.
+    std::unique_ptr<JobSystem> jobs;
+    int workerThreads = 0;
+    // Blocos pequenos: os benchmarks rodam com 5 a 30 agentes, e blocos de
+    // centenas deixariam tudo num bloco só, na thread que chama
+    static constexpr size_t UPDATE_GRAIN = 8;  // Slots por bloco
+    static constexpr size_t PAIR_GRAIN = 8;    // Pontos por bloco em findPairs
+    
     // === Métricas de desempenho para SimulationLogger ===
     int collisionCount = 0;                  // Total de colisões únicas detectadas
     double totalAvoidanceTimeMs = 0.0;       // Soma do tempo gasto no algoritmo de evasão (ms)
@@ -46,9 +133,16 @@ private:
     float collisionDetectionRadius = 8.0f;   // Raio para contar colisões reais (= raio do agente)
     // Rastreia pares que já estão em colisão para não contar duplicatas por frame
     std::set<std::pair<GameAgent*, GameAgent*>> activeCollisionPairs;
+    long long totalExpandedNodes = 0;        // Nós expandidos pelas buscas (todos os motores)
+    int pathQueryCount = 0;                  // Quantas buscas foram contabilizadas
+    long long totalWaypoints = 0;            // Waypoints entregues aos agentes
+    int assignedPathCount = 0;               // Quantos caminhos foram entregues
 
 public:
-    GameAgentManager(IGridAdapter* adapter, GridType type = GridType::RECTANGULAR) 
+    // `map`: arquivo de onde o grid foi carregado; componentes conexas e
+    // landmarks gravados nele são usados em vez de recalculados
+    GameAgentManager(IGridAdapter* adapter, GridType type = GridType::RECTANGULAR,
+                     const MapFile* map = nullptr) 
         : gridAdapter(adapter), gridType(type) {
         // Inicializa observers globais
         respawnObserver = std::make_unique<AgentRespawnObserver>(3.0f);
@@ -67,17 +161,289 @@ public:
             CollisionManager::getInstance()->setWarningRadius(25.0f);
             CollisionManager::getInstance()->setCollisionRadius(12.0f);
         }
+        
+        pathCache = std::make_unique<PathCache>(adapter);
+        GridChangeNotifier::getInstance()->addObserver(pathCache.get());
+
+        int32_t labelCount = 0;
+        const int32_t* labels = map ? map->getReachabilityLabels(labelCount) : nullptr;
+        if (labels) {
+            reachability = std::make_unique<ReachabilityIndex>(adapter, type, labels, labelCount);
+        } else {
+            reachability = std::make_unique<ReachabilityIndex>(adapter, type);
+        }
+        GridChangeNotifier::getInstance()->addObserver(reachability.get());
+
+        const Cell* landmarkCells = nullptr;
+        int landmarkCount = 0;
+        const uint16_t* distances = map ? map->getLandmarkDistances(landmarkCells, landmarkCount) : nullptr;
+        if (distances) {
+            auto table = std::make_shared<LandmarkTable>();
+            table->adopt(adapter->GetWidth(), adapter->GetHeight(), type, adapter->getJournal().getVersion(),
+                         landmarkCells, landmarkCount, distances, map->getOwner());
+            precomputedLandmarks = std::move(table);
+            setLandmarkHeuristic(true, landmarkCount);
+        }
     }
     
     ~GameAgentManager() {
         if (collisionObserver) {
             CollisionManager::getInstance()->removeObserver(collisionObserver.get());
         }
+        setHierarchicalPathfinding(false);
+        setFlowFieldNavigation(false);
+        GridChangeNotifier::getInstance()->removeObserver(pathCache.get());
+        GridChangeNotifier::getInstance()->removeObserver(reachability.get());
+        setAsyncPathfinding(false);
+        setTimeSlicedPathfinding(false);
+        setIncrementalReplanning(false);
+        setLandmarkHeuristic(false);
+        setCooperativePathfinding(false);
+        releaseAgents();
     }
     
     void setGridAdapter(IGridAdapter* adapter, GridType type) {
         gridAdapter = adapter;
         gridType = type;
+        precomputedLandmarks.reset();
+        GridChangeNotifier::getInstance()->removeObserver(pathCache.get());
+        pathCache = std::make_unique<PathCache>(adapter);
+        GridChangeNotifier::getInstance()->addObserver(pathCache.get());
+        GridChangeNotifier::getInstance()->removeObserver(reachability.get());
+        reachability = std::make_unique<ReachabilityIndex>(adapter, type);
+        GridChangeNotifier::getInstance()->addObserver(reachability.get());
+        if (hierarchicalPathfinder) {
+            int clusterSize = hierarchicalPathfinder->getClusterSize();
+            setHierarchicalPathfinding(false);
+            setHierarchicalPathfinding(true, clusterSize);
+        }
+        if (flowFieldCache) {
+            setFlowFieldNavigation(false);
+            setFlowFieldNavigation(true);
+        }
+        if (pathService) {
+            int threads = (int)pathService->getThreadCount();
+            setAsyncPathfinding(false);
+            setAsyncPathfinding(true, threads);
+        }
+        if (replanChanges) {
+            setIncrementalReplanning(false);
+            setIncrementalReplanning(true);
+        }
+        if (pathScheduler) {
+            int expansions = pathScheduler->getExpansionBudget();
+            double microseconds = pathScheduler->getTimeBudgetUs();
+            setTimeSlicedPathfinding(false);
+            setTimeSlicedPathfinding(true, expansions, microseconds);
+        }
+        if (landmarks) {
+            int count = landmarks->getLandmarkCount();
+            setLandmarkHeuristic(false);
+            setLandmarkHeuristic(true, count);
+        }
+        if (cooperativePlanner) {
+            int window = cooperativePlanner->getWindow();
+            setCooperativePathfinding(false);
+            setCooperativePathfinding(true, window);
+        }
+    }
+    
+    // Liga/desliga a busca hierárquica (HPA*). A hierarquia é construída uma vez
+    // e reparada incrementalmente a cada obstáculo alterado.
+    void setHierarchicalPathfinding(bool enabled, int clusterSize = 16) {
+        if (hierarchicalPathfinder) {
+            GridChangeNotifier::getInstance()->removeObserver(hierarchicalPathfinder.get());
+            hierarchicalPathfinder.reset();
+        }
+        if (enabled && gridAdapter) {
+            hierarchicalPathfinder = std::make_unique<HierarchicalPathfinder>(
+                gridAdapter, gridType, clusterSize);
+            GridChangeNotifier::getInstance()->addObserver(hierarchicalPathfinder.get());
+            std::cout << "[HPA*] Hierarquia construida: "
+                      << hierarchicalPathfinder->getAbstractNodeCount() << " nos abstratos" << std::endl;
+        }
+    }
+    
+    bool isHierarchicalPathfinding() const { return hierarchicalPathfinder != nullptr; }
+    
+    // Área do mundo (pixels) que a câmera mostra neste frame
+    void setViewport(Rectangle area) { viewport = area; }
+    
+    // Threads usadas por updateAll (contando a principal); 0 = uma por núcleo.
+    // O resultado da simulação não depende desse número.
+    void setWorkerThreads(int count) {
+        workerThreads = std::max(0, count);
+        jobs.reset();
+    }
+    int getWorkerThreads() { return (int)getJobs().getThreadCount(); }
+    
+    // Liga/desliga a suavização any-angle dos caminhos entregues aos agentes
+    void setPathSmoothing(bool enabled) { pathSmoothing = enabled; }
+    bool isPathSmoothing() const { return pathSmoothing; }
+    
+    // Liga/desliga a heurística ALT. As tabelas são calculadas em segundo
+    // plano; até ficarem prontas (ou após liberar células) as buscas usam a
+    // heurística normal.
+    void setLandmarkHeuristic(bool enabled, int landmarkCount = LandmarkHeuristic::DEFAULT_LANDMARKS) {
+        landmarks.reset();
+        if (enabled && gridAdapter) {
+            // A tabela do arquivo só é aceita se o mapa não mudou desde o carregamento
+            landmarks = std::make_unique<LandmarkHeuristic>(gridAdapter, gridType, landmarkCount, 30,
+                                                            precomputedLandmarks);
+        }
+    }
+    
+    bool isLandmarkHeuristic() const { return landmarks != nullptr; }
+    LandmarkHeuristic* getLandmarkHeuristic() const { return landmarks.get(); }
+    
+    // Liga/desliga a navegação por flow field. Agentes com o mesmo destino
+    // compartilham um único campo em vez de cada um rodar sua própria busca.
+    void setFlowFieldNavigation(bool enabled) {
+        if (enabled) setCooperativePathfinding(false);
+        if (flowFieldCache) {
+            for (auto& agent : agents) {
+                releaseFlowField(agent.get());
+            }
+            GridChangeNotifier::getInstance()->removeObserver(flowFieldCache.get());
+            flowFieldCache.reset();
+        }
+        if (enabled && gridAdapter) {
+            flowFieldCache = std::make_unique<FlowFieldCache>(gridAdapter, gridType);
+            GridChangeNotifier::getInstance()->addObserver(flowFieldCache.get());
+        }
+        // Agentes voltam a buscar caminho (ou campo) a partir da posição atual
+        for (auto& agent : agents) {
+            agent->setHasPath(false);
+        }
+    }
+    
+    bool isFlowFieldNavigation() const { return flowFieldCache != nullptr; }
+    
+    size_t getFlowFieldCount() const {
+        return flowFieldCache ? flowFieldCache->getFieldCount() : 0;
+    }
+    
+    // Liga/desliga as buscas assíncronas (pool de threads). Buscas pendentes
+    // são descartadas ao desligar.
+    void setAsyncPathfinding(bool enabled, int threadCount = 0) {
+        if (enabled) setTimeSlicedPathfinding(false);
+        if (pathService) {
+            pathService.reset();
+            pendingPathTickets.clear();
+            pendingPathAgents.clear();
+        }
+        if (enabled && gridAdapter) {
+            pathService = std::make_unique<PathfindingService>(gridAdapter, gridType, threadCount);
+            std::cout << "[Async] Buscas em " << pathService->getThreadCount() 
+                      << " threads" << std::endl;
+        }
+    }
+    
+    bool isAsyncPathfinding() const { return pathService != nullptr; }
+    
+    // Liga/desliga as buscas fatiadas: no máximo `expansionsPerFrame` expansões
+    // ou `microsecondsPerFrame` por frame, divididas por prioridade (agentes
+    // visíveis na tela primeiro). Exclusivo com o modo assíncrono.
+    void setTimeSlicedPathfinding(bool enabled, int expansionsPerFrame = 2000,
+                                  double microsecondsPerFrame = 2000.0) {
+        if (enabled) setAsyncPathfinding(false);
+        if (pathScheduler) {
+            pathScheduler.reset();
+            pendingPathTickets.clear();
+            pendingPathAgents.clear();
+        }
+        if (enabled && gridAdapter) {
+            pathScheduler = std::make_unique<PathfindingScheduler>(
+                gridAdapter, gridType, expansionsPerFrame, microsecondsPerFrame);
+        }
+    }
+    
+    bool isTimeSlicedPathfinding() const { return pathScheduler != nullptr; }
+    PathfindingScheduler* getPathfindingScheduler() const { return pathScheduler.get(); }
+    
+    // Fração média do orçamento de busca usada por frame (0 se desligado)
+    double getAveragePathBudgetUse() const {
+        return pathScheduler ? pathScheduler->getAverageBudgetUse() : 0.0;
+    }
+    
+    long long getPathBudgetExhaustedFrames() const {
+        return pathScheduler ? pathScheduler->getExhaustedFrames() : 0;
+    }
+    
+    // Liga/desliga o replanejamento incremental (D* Lite por agente). Com o
+    // mapa sendo pintado continuamente, cada agente só repara a parte da sua
+    // árvore de busca afetada pelas células alteradas.
+    void setIncrementalReplanning(bool enabled) {
+        if (enabled) setCooperativePathfinding(false);
+        replanChanges.reset();
+        for (auto& agent : agents) {
+            agent->setPlanner(nullptr);
+            agent->setHasPath(false);
+        }
+        if (enabled && gridAdapter) {
+            replanChanges = std::make_unique<GridChangeCollector>(gridAdapter);
+        }
+    }
+    
+    bool isIncrementalReplanning() const { return replanChanges != nullptr; }
+    
+    // Liga/desliga a busca cooperativa em janela (WHCA*): os agentes reservam
+    // células por passo numa tabela comum e planejam desviando das reservas
+    // dos outros, então corredores não geram conflitos frente a frente para a
+    // evasão resolver. Exclusivo com flow field e D* Lite.
+    void setCooperativePathfinding(bool enabled, int window = 16) {
+        if (enabled) {
+            setFlowFieldNavigation(false);
+            setIncrementalReplanning(false);
+        }
+        if (cooperativePlanner) {
+            GridChangeNotifier::getInstance()->removeObserver(cooperativePlanner.get());
+            cooperativePlanner.reset();
+            cooperativeIds.clear();
+        }
+        if (enabled && gridAdapter) {
+            cooperativePlanner = std::make_unique<CooperativePlanner>(gridAdapter, gridType, window);
+            GridChangeNotifier::getInstance()->addObserver(cooperativePlanner.get());
+        }
+        for (auto& agent : agents) {
+            agent->setHasPath(false);
+        }
+    }
+    
+    bool isCooperativePathfinding() const { return cooperativePlanner != nullptr; }
+    CooperativePlanner* getCooperativePlanner() const { return cooperativePlanner.get(); }
+    size_t getPendingPathQueries() const { return pendingPathTickets.size(); }
+    
+    ReachabilityIndex* getReachabilityIndex() const { return reachability.get(); }
+    
+    // Grava o mapa atual com os dados pré-calculados: componentes conexas e
+    // landmarks (a tabela em uso, se for da versão atual; senão calcula agora)
+    bool saveMap(const std::string& path, std::string* error = nullptr) {
+        if (!gridAdapter) return false;
+        MapFile::Contents contents;
+        contents.occupancy = &gridAdapter->getOccupancy();
+        contents.gridType = gridType;
+
+        std::vector<int32_t> labels;
+        contents.labelCount = reachability->exportLabels(labels);
+        contents.labels = labels.data();
+
+        uint64_t version = gridAdapter->getJournal().getVersion();
+        std::shared_ptr<const LandmarkTable> table = landmarks ? landmarks->getTable() : nullptr;
+        if (!table || table->getVersion() != version) {
+            auto built = std::make_shared<LandmarkTable>();
+            const ObstacleBitGrid& occupancy = gridAdapter->getOccupancy();
+            built->build(gridAdapter->GetWidth(), gridAdapter->GetHeight(), gridType, version,
+                         landmarks ? landmarks->getLandmarkCount() : LandmarkHeuristic::DEFAULT_LANDMARKS,
+                         [&occupancy](int x, int y) { return occupancy.isWalkable(x, y); });
+            table = std::move(built);
+        }
+        if (table->getLandmarkCount() > 0) {
+            contents.landmarks = table->getLandmarks().data();
+            contents.landmarkCount = table->getLandmarkCount();
+            contents.landmarkDistances = table->getDistances();
+        }
+        return MapFile::save(path, contents, error);
     }
     
     // Controle do sistema de colisão
@@ -120,22 +486,143 @@ public:
         return {(int)(worldPos.x / cellSize), (int)(worldPos.y / cellSize)};
     }
     
-    // Encontra caminho usando o adapter apropriado
+    // Encontra caminho usando o adapter apropriado (consultando antes o cache)
     std::vector<Vector2> findPath(Vector2 startGrid, Vector2 endGrid) {
+        if (hierarchicalPathfinder) {
+            std::vector<Cell> cells;
+            std::vector<Vector2> path;
+            if (hierarchicalPathfinder->findPath({(int)startGrid.x, (int)startGrid.y},
+                                                 {(int)endGrid.x, (int)endGrid.y}, cells,
+                                                 landmarks ? landmarks->current() : nullptr)) {
+                path.reserve(cells.size());
+                for (const auto& cell : cells) {
+                    path.push_back({(float)cell.x, (float)cell.y});
+                }
+            }
+            totalExpandedNodes += hierarchicalPathfinder->getLastExpandedNodes();
+            pathQueryCount++;
+            return path;
+        }
+        
+        PathCacheKey key = pathCache->makeKey({(int)startGrid.x, (int)startGrid.y},
+                                              {(int)endGrid.x, (int)endGrid.y}, gridType);
+        std::vector<Vector2> path;
+        if (pathCache->lookup(key, path)) {
+            return path;
+        }
+        path = searchPath(startGrid, endGrid);
+        pathCache->store(key, path);
+        return path;
+    }
+    
+    PathCache* getPathCache() const { return pathCache.get(); }
+    
+    // Busca sem cache: FindPathHex no hexagonal, algoritmo escolhido no retangular
+    std::vector<Vector2> searchPath(Vector2 startGrid, Vector2 endGrid) {
+        if (gridType == GridType::HEXAGONAL) {
+            auto* hexAdapter = dynamic_cast<HexagonalGridAdapter*>(gridAdapter);
+            if (hexAdapter) {
+                std::vector<Vector2> path = hexAdapter->FindPathHex(startGrid, endGrid,
+                    landmarks ? landmarks->current() : nullptr);
+                totalExpandedNodes += hexAdapter->GetLastExpandedNodes();
+                pathQueryCount++;
+                return path;
+            }
+        }
+        // Grid retangular - usa o algoritmo escolhido (ou o pathfinder legacy)
+        std::vector<Vector2> path;
+        const LandmarkTable* table = landmarks ? landmarks->current() : nullptr;
+        if (pathAlgorithm) {
+            path = pathAlgorithm->FindPath(gridAdapter, startGrid, endGrid, table);
+            totalExpandedNodes += pathAlgorithm->GetLastExpandedNodes();
+        } else {
+            path = Pathfinder::FindPath(gridAdapter->GetLegacyGrid(), startGrid, endGrid, "random",
+                                        PathfindingAlgorithm::ASTAR, table);
+            totalExpandedNodes += Pathfinder::GetLastExpandedNodes();
+        }
+        pathQueryCount++;
+        return path;
+    }
+    
+    // Versão em lote de findPath: consulta o cache e responde as faltas com
+    // uma única chamada ao motor em lote (agrupado por destino)
+    std::vector<std::vector<Vector2>> findPaths(const std::vector<PathQuery>& queries) {
+        std::vector<std::vector<Vector2>> paths(queries.size());
+        if (hierarchicalPathfinder) {
+            for (size_t i = 0; i < queries.size(); ++i) {
+                paths[i] = findPath({(float)queries[i].start.x, (float)queries[i].start.y},
+                                    {(float)queries[i].goal.x, (float)queries[i].goal.y});
+            }
+            return paths;
+        }
+        
+        std::vector<PathQuery> misses;
+        std::vector<size_t> missIndex;
+        for (size_t i = 0; i < queries.size(); ++i) {
+            PathCacheKey key = pathCache->makeKey(queries[i].start, queries[i].goal, gridType);
+            if (!pathCache->lookup(key, paths[i])) {
+                misses.push_back(queries[i]);
+                missIndex.push_back(i);
+            }
+        }
+        if (misses.empty()) return paths;
+        
+        std::vector<std::vector<Vector2>> found = searchPaths(misses);
+        for (size_t j = 0; j < misses.size(); ++j) {
+            pathCache->store(pathCache->makeKey(misses[j].start, misses[j].goal, gridType), found[j]);
+            paths[missIndex[j]] = std::move(found[j]);
+        }
+        return paths;
+    }
+    
+    // Busca em lote sem cache: FindPathsHex no hexagonal, Pathfinder::FindPaths
+    // no retangular. Uma consulta sozinha, e cada consulta isolada do lote,
+    // segue pelo algoritmo escolhido (A* ou JPS).
+    std::vector<std::vector<Vector2>> searchPaths(const std::vector<PathQuery>& queries) {
+        if (queries.size() == 1) {
+            return {searchPath({(float)queries[0].start.x, (float)queries[0].start.y},
+                               {(float)queries[0].goal.x, (float)queries[0].goal.y})};
+        }
+        std::vector<std::vector<Vector2>> paths;
         if (gridType == GridType::HEXAGONAL) {
             auto* hexAdapter = dynamic_cast<HexagonalGridAdapter*>(gridAdapter);
             if (hexAdapter) {
-                return hexAdapter->FindPathHex(startGrid, endGrid);
+                paths = hexAdapter->FindPathsHex(queries, landmarks ? landmarks->current() : nullptr);
+                totalExpandedNodes += hexAdapter->GetLastBatchExpandedNodes();
+                pathQueryCount += (int)queries.size();
+                return paths;
             }
         }
-        // Grid retangular - usa o pathfinder legacy
-        return Pathfinder::FindPath(gridAdapter->GetLegacyGrid(), startGrid, endGrid, "random");
+        paths = Pathfinder::FindPaths(gridAdapter->GetLegacyGrid(), queries, "random", pathAlgorithmKind,
+                                      landmarks ? landmarks->current() : nullptr);
+        totalExpandedNodes += Pathfinder::GetLastExpandedNodes();
+        pathQueryCount += (int)queries.size();
+        return paths;
+    }
+    
+    // === Strategy Pattern: Algoritmo de busca ===
+    // O cache é esvaziado: caminhos do motor anterior não podem responder
+    // pelo novo (a comparação A*/JPS mediria acertos do cache). `kind` diz
+    // qual motor a estratégia é, para os modos que não usam o IAlgorithm
+    // (busca assíncrona e lotes) escolherem o mesmo.
+    void setPathfindingAlgorithm(std::unique_ptr<IAlgorithm> algorithm, PathfindingAlgorithm kind) {
+        pathAlgorithm = std::move(algorithm);
+        pathAlgorithmKind = kind;
+        pathCache->clear();
+        if (pathAlgorithm) {
+            std::cout << "[Strategy] Algoritmo de busca: " 
+                      << pathAlgorithm->GetName() << std::endl;
+        }
+    }
+    
+    IAlgorithm* getPathfindingAlgorithm() const {
+        return pathAlgorithm.get();
     }
     
     GameAgent* addAgent(Vector2 start, Vector2 target) {
         Vector2 worldStart = gridToWorld((int)start.x, (int)start.y);
         
-        auto agent = std::make_unique<GameAgent>(worldStart, target);
+        auto agent = std::make_unique<GameAgent>(store, worldStart, target);
         
         // Adiciona os observers ao novo agente
         agent->addObserver(respawnObserver.get());
@@ -174,6 +661,9 @@ public:
     }
     
     void removeAgent(GameAgent* agent) {
+        releaseFlowField(agent);
+        forgetCooperativePlan(agent);
+        forgetPendingPath(agent);
         agents.erase(
             std::remove_if(agents.begin(), agents.end(),
                 [agent](const std::unique_ptr<GameAgent>& a) {
@@ -188,7 +678,8 @@ public:
         collisionAvoidance = std::move(strategy);
         if (collisionAvoidance) {
             float cellSize = gridAdapter->GetCellSize();
-            collisionAvoidance->initialize(1.0f / 60.0f, cellSize / 3.0f, 2.0f);
+            collisionAvoidance->initialize(1.0f / 60.0f, cellSize / 3.0f, 2.0f,
+                                           gridAdapter->getWorldSize());
             collisionAvoidanceEnabled = true;
             std::cout << "[Strategy] Evasao de colisao: " 
                       << collisionAvoidance->getName() << std::endl;
@@ -208,31 +699,423 @@ public:
     
     bool isCollisionAvoidanceEnabled() const { return collisionAvoidanceEnabled; }
     
-    void updateAll(float deltaTime) {
-        // Coleta agentes vivos
-        std::vector<GameAgent*> aliveAgents;
+    // Agente sem caminho pede um. Síncrono: busca agora. Assíncrono: consulta o
+    // cache e, se não houver, enfileira a busca (o agente fica parado até a
+    // entrega em deliverPathResults).
+    // Alvos inalcançáveis são rejeitados pelo índice de componentes sem busca,
+    // e o agente só tenta de novo quando a estrutura do mapa mudar.
+    void requestPath(GameAgent* agent) {
+        Cell gridCell = worldToGrid(agent->getPosition());
+        Vector2 startGrid = {(float)gridCell.x, (float)gridCell.y};
+        
+        if (!canReachTarget(agent, gridCell)) return;
+        
+        if ((!pathService && !pathScheduler) || hierarchicalPathfinder) {
+            auto newPath = findPath(startGrid, agent->getTarget());
+            if (newPath.empty()) {
+                agent->pathBlocked();
+            } else {
+                assignPath(agent, newPath);
+            }
+            return;
+        }
+        
+        if (pendingPathTickets.count(agent)) return;  // Já aguardando resultado
+        
+        Vector2 target = agent->getTarget();
+        Cell goal = {(int)target.x, (int)target.y};
+        PathCacheKey key = pathCache->makeKey(gridCell, goal, gridType);
+        std::vector<Vector2> cached;
+        if (pathCache->lookup(key, cached)) {
+            if (cached.empty()) {
+                agent->pathBlocked();
+            } else {
+                assignPath(agent, cached);
+            }
+            return;
+        }
+        
+        uint64_t ticket;
+        if (pathScheduler) {
+            ticket = pathScheduler->submit(gridCell, goal, isOnScreen(agent) ? 1 : 0,
+                                           landmarks ? landmarks->shareCurrent() : nullptr);
+        } else {
+            ticket = pathService->submit(gridCell, goal, pathAlgorithmKind,
+                                         landmarks ? landmarks->shareCurrent() : nullptr);
+        }
+        pendingPathTickets[agent] = ticket;
+        pendingPathAgents[ticket] = agent;
+    }
+    
+    // Falso (sem busca) se o alvo está fora do componente do agente; o agente
+    // só volta a ser testado quando a estrutura do mapa mudar
+    bool canReachTarget(GameAgent* agent, Cell gridCell) {
+        if (isKnownBlocked(agent)) return false;
+        Vector2 targetGrid = agent->getTarget();
+        if (!reachability->isReachable(gridCell, {(int)targetGrid.x, (int)targetGrid.y})) {
+            markBlocked(agent);
+            return false;
+        }
+        return true;
+    }
+    
+    // O alvo já se mostrou inalcançável e o mapa não mudou desde então
+    bool isKnownBlocked(const GameAgent* agent) const {
+        return agent->getBlockedVersion() == reachability->getVersion();
+    }
+    
+    // AGENT_PATH_BLOCKED sai uma vez por versão do mapa, não a cada frame
+    void markBlocked(GameAgent* agent) {
+        if (isKnownBlocked(agent)) return;
+        agent->setBlockedVersion(reachability->getVersion());
+        agent->pathBlocked();
+    }
+    
+    // Busca síncrona: os agentes que ficaram sem caminho neste frame (ex.: um
+    // lote recém-criado por addRandomAgents) pedem juntos, e o lote é agrupado
+    // por destino. Com um só agente esperando, o pedido individual resolve.
+    void requestPendingPaths() {
+        if (pathService || pathScheduler) return;
+        std::vector<GameAgent*> waiting;
+        std::vector<PathQuery> queries;
+        for (auto& agent : agents) {
+            if (!agent->isAlive() || agent->hasReachedTarget() || agent->getHasPath()) continue;
+            Cell gridCell = worldToGrid(agent->getPosition());
+            if (!canReachTarget(agent.get(), gridCell)) continue;
+            Vector2 target = agent->getTarget();
+            waiting.push_back(agent.get());
+            queries.push_back({gridCell, {(int)target.x, (int)target.y}});
+        }
+        if (queries.size() < 2) return;
+        
+        std::vector<std::vector<Vector2>> paths = findPaths(queries);
+        for (size_t i = 0; i < waiting.size(); ++i) {
+            if (paths[i].empty()) {
+                waiting[i]->pathBlocked();
+            } else {
+                assignPath(waiting[i], paths[i]);
+            }
+        }
+    }
+    
+    bool isOnScreen(GameAgent* agent) const {
+        return isInViewport(agent->getPosition(), 0.0f);
+    }
+    
+    // `pos` dentro da área da câmera aumentada de `margin` em cada lado
+    bool isInViewport(Vector2 pos, float margin) const {
+        if (viewport.width <= 0.0f) return true;  // Sem câmera: o mapa todo está visível
+        return pos.x >= viewport.x - margin && pos.y >= viewport.y - margin &&
+               pos.x < viewport.x + viewport.width + margin &&
+               pos.y < viewport.y + viewport.height + margin;
+    }
+    
+    // Ponto de sincronização do frame: aplica os resultados prontos na ordem
+    // em que foram pedidos. Resultados calculados sobre um grid que mudou
+    // depois são conferidos; se ficaram inválidos, a busca é refeita.
+    void deliverPathResults() {
+        if (pathScheduler) {
+            pathScheduler->runFrame();
+            for (auto& result : pathScheduler->takeCompleted()) {
+                applyPathResult(result, pathScheduler->getGridVersion());
+            }
+        }
+        if (pathService) {
+            for (auto& result : pathService->collect()) {
+                applyPathResult(result, pathService->getGridVersion());
+            }
+        }
+    }
+    
+    void applyPathResult(PathResult& result, uint64_t currentGridVersion) {
+        totalExpandedNodes += result.expandedNodes;
+        pathQueryCount++;
+        
+        auto it = pendingPathAgents.find(result.ticket);
+        if (it == pendingPathAgents.end()) return;  // Agente removido
+        GameAgent* agent = it->second;
+        pendingPathAgents.erase(it);
+        pendingPathTickets.erase(agent);
+        
+        bool current = result.gridVersion == currentGridVersion;
+        if (!current) {
+            bool stillValid = !result.path.empty();
+            for (const auto& p : result.path) {
+                if (!gridAdapter->IsWalkable((int)p.x, (int)p.y)) {
+                    stillValid = false;
+                    break;
+                }
+            }
+            if (!stillValid) {
+                agent->setHasPath(false);
+                return;  // Será pedido de novo no update
+            }
+        } else {
+            pathCache->store(pathCache->makeKey(result.start, result.goal, gridType), result.path);
+        }
+        
+        if (result.path.empty()) {
+            agent->pathBlocked();
+        } else {
+            assignPath(agent, result.path);
+        }
+    }
+    
+    // Entrega o caminho (em células) ao agente, suavizado se a opção estiver ligada
+    void assignPath(GameAgent* agent, const std::vector<Vector2>& path) {
+        if (pathSmoothing) {
+            float cellSize = gridAdapter->GetCellSize();
+            agent->setPath(PathSmoother::smooth(path,
+                [this](int col, int row) { return gridToWorld(col, row); },
+                [this](Vector2 p) { return worldToGrid(p); },
+                [this](int x, int y) { return gridAdapter->IsWalkable(x, y); },
+                cellSize * 0.2f, cellSize * 0.35f));
+        } else {
+            agent->setPath(path);
+        }
+        totalWaypoints += agent->getPath().size();
+        assignedPathCount++;
+    }
+    
+    void forgetPendingPath(GameAgent* agent) {
+        auto it = pendingPathTickets.find(agent);
+        if (it == pendingPathTickets.end()) return;
+        if (pathScheduler) pathScheduler->cancel(it->second);
+        else if (pathService) pathService->cancel(it->second);
+        pendingPathAgents.erase(it->second);
+        pendingPathTickets.erase(it);
+    }
+    
+    // Velocidade desejada lida do flow field do destino do agente.
+    // Retorna {0,0} se chegou ao destino ou se o destino é inalcançável.
+    Vector2 flowFieldVelocity(GameAgent* agent) {
+        if (!agent->getFlowField()) {
+            Vector2 target = agent->getTarget();
+            agent->setFlowField(flowFieldCache->acquire({(int)target.x, (int)target.y}));
+        }
+        FlowField* field = agent->getFlowField();
+        Cell goal = field->getGoal();
+        Cell current = worldToGrid(agent->getPosition());
+        
+        Cell next = goal;
+        if (!(current == goal) && !field->getNextCell(current, next)) {
+            markBlocked(agent);
+            return {0.0f, 0.0f};
+        }
+        
+        Vector2 velocity = steerToCell(agent, current, next, goal);
+        if (agent->hasReachedTarget()) {
+            releaseFlowField(agent);
+        }
+        return velocity;
+    }
+    
+    // Velocidade desejada a partir do D* Lite do agente (criado no primeiro uso)
+    Vector2 incrementalVelocity(GameAgent* agent) {
+        Cell current = worldToGrid(agent->getPosition());
+        Vector2 target = agent->getTarget();
+        Cell goal = {(int)target.x, (int)target.y};
+        
+        // A heurística do planejador é fixa: com outra tabela ALT (ou sem
+        // nenhuma admissível), o planejador é refeito
+        const LandmarkTable* table = landmarks ? landmarks->current() : nullptr;
+        if (!agent->getPlanner() || agent->getPlanner()->getLandmarks() != table) {
+            agent->setPlanner(std::make_unique<DStarLite>(gridAdapter, gridType, current, goal,
+                                                          landmarks ? landmarks->shareCurrent() : nullptr));
+        }
+        // Sem caminho e sem mudança no mapa desde então: nada a replanejar
+        if (!(current == goal) && isKnownBlocked(agent)) return {0.0f, 0.0f};
+        
+        DStarLite* planner = agent->getPlanner();
+        planner->moveTo(current);
+        bool reachable = planner->computeShortestPath();
+        if (planner->getLastExpandedNodes() > 0) {
+            totalExpandedNodes += planner->getLastExpandedNodes();
+            pathQueryCount++;
+        }
+        
+        Cell next = goal;
+        if (!(current == goal) && (!reachable || !planner->getNextCell(next))) {
+            markBlocked(agent);
+            return {0.0f, 0.0f};
+        }
+        
+        Vector2 velocity = steerToCell(agent, current, next, goal);
+        if (agent->hasReachedTarget()) {
+            agent->setPlanner(nullptr);
+        }
+        return velocity;
+    }
+    
+    // Velocidade desejada seguindo o plano cooperativo: o agente vai ao centro
+    // da célula reservada para o próximo passo e espera lá até o passo virar
+    Vector2 cooperativeVelocity(GameAgent* agent) {
+        Cell current = worldToGrid(agent->getPosition());
+        Vector2 target = agent->getTarget();
+        Cell goal = {(int)target.x, (int)target.y};
+        
+        auto it = cooperativeIds.find(agent);
+        if (it == cooperativeIds.end()) {
+            if (!reachability->isReachable(current, goal)) {
+                agent->pathBlocked();
+                return {0.0f, 0.0f};
+            }
+            int id = cooperativePlanner->addAgent(current, goal);
+            if (id == CooperativePlanner::INVALID_AGENT) {
+                agent->pathBlocked();
+                return {0.0f, 0.0f};
+            }
+            it = cooperativeIds.emplace(agent, id).first;
+        }
+        
+        Cell next = cooperativePlanner->getNextCell(it->second);
+        Vector2 pos = agent->getPosition();
+        Vector2 targetWorldPos = gridToWorld(next.x, next.y);
+        Vector2 direction = {targetWorldPos.x - pos.x, targetWorldPos.y - pos.y};
+        float distance = std::sqrt(direction.x * direction.x + direction.y * direction.y);
+        bool arrived = distance <= agent->getSpeed();
+        cooperativePlanner->reportPosition(it->second, current, arrived);
+        
+        if (arrived && current == goal && next == goal) {
+            forgetCooperativePlan(agent);
+            agent->setHasPath(false);
+            agent->reachTarget();
+            return {0.0f, 0.0f};
+        }
+        if (arrived) return direction;  // Encosta no centro e aguarda o passo
+        return {(direction.x / distance) * agent->getSpeed(),
+                (direction.y / distance) * agent->getSpeed()};
+    }
+    
+    // Avança o relógio da busca cooperativa. Agentes mortos liberam as reservas;
+    // um passo dura no máximo o dobro do tempo que o agente mais lento leva
+    // para cruzar uma célula.
+    void stepCooperative(float deltaTime) {
+        float slowest = 0.0f;
+        for (auto it = cooperativeIds.begin(); it != cooperativeIds.end();) {
+            GameAgent* agent = it->first;
+            if (!agent->isAlive() || agent->hasReachedTarget()) {
+                cooperativePlanner->removeAgent(it->second);
+                it = cooperativeIds.erase(it);
+                continue;
+            }
+            if (slowest == 0.0f || agent->getSpeed() < slowest) slowest = agent->getSpeed();
+            ++it;
+        }
+        if (slowest > 0.0f) {
+            Vector2 a = gridToWorld(0, 0);
+            Vector2 b = gridToWorld(1, 0);
+            float cellDistance = std::sqrt((b.x - a.x) * (b.x - a.x) + (b.y - a.y) * (b.y - a.y));
+            cooperativePlanner->update(deltaTime, 2.0f * cellDistance / (slowest * 60.0f));
+        }
+        int expanded = cooperativePlanner->takeExpandedNodes();
+        if (expanded > 0) {
+            totalExpandedNodes += expanded;
+            pathQueryCount++;
+        }
+    }
+    
+    void forgetCooperativePlan(GameAgent* agent) {
+        auto it = cooperativeIds.find(agent);
+        if (it == cooperativeIds.end()) return;
+        if (cooperativePlanner) cooperativePlanner->removeAgent(it->second);
+        cooperativeIds.erase(it);
+    }
+    
+    // Direção (já escalada pela velocidade) do agente até o centro de `next`.
+    // No destino, marca a chegada quando o agente alcança o centro da célula.
+    Vector2 steerToCell(GameAgent* agent, Cell current, Cell next, Cell goal) {
+        Vector2 pos = agent->getPosition();
+        Vector2 targetWorldPos = gridToWorld(next.x, next.y);
+        Vector2 direction = {targetWorldPos.x - pos.x, targetWorldPos.y - pos.y};
+        float distance = std::sqrt(direction.x * direction.x + direction.y * direction.y);
+        
+        if (current == goal && distance < 5.0f) {
+            agent->setHasPath(false);
+            agent->reachTarget();
+            return {0.0f, 0.0f};
+        }
+        if (distance < 0.001f) return {0.0f, 0.0f};
+        return {(direction.x / distance) * agent->getSpeed(),
+                (direction.y / distance) * agent->getSpeed()};
+    }
+    
+    // Repassa aos planejadores D* Lite as células alteradas desde o último frame
+    void applyReplanChanges() {
+        if (!replanChanges || !replanChanges->hasChanges()) return;
+        bool complete = true;
+        std::vector<Cell> changed = replanChanges->take(&complete);
+        if (!complete) {
+            // O diário já descartou parte das alterações: replaneja do zero
+            for (auto& agent : agents) {
+                agent->setPlanner(nullptr);
+                agent->setHasPath(false);
+            }
+            return;
+        }
         for (auto& agent : agents) {
-            if (agent->isAlive() && !agent->hasReachedTarget()) {
-                aliveAgents.push_back(agent.get());
+            if (agent->getPlanner()) {
+                agent->getPlanner()->cellsChanged(changed);
             }
         }
+    }
+    
+    void releaseFlowField(GameAgent* agent) {
+        if (flowFieldCache && agent->getFlowField()) {
+            flowFieldCache->release(agent->getFlowField());
+        }
+        agent->setFlowField(nullptr);
+    }
+    
+    // Um passo da simulação de `deltaTime` segundos (a aplicação usa um
+    // passo fixo, ver SimulationClock)
+    void updateAll(float deltaTime) {
+        store.beginStep();
+        if (landmarks) landmarks->update();
+        deliverPathResults();
+        applyReplanChanges();
+        if (cooperativePlanner) stepCooperative(deltaTime);
+        else if (!flowFieldCache && !replanChanges) requestPendingPaths();
+        
+        // Coleta os slots ativos numa passada linear pelas flags do store
+        std::vector<uint32_t> aliveSlots;
+        aliveSlots.reserve(store.size());
+        for (uint32_t i = 0; i < store.size(); ++i) {
+            if (store.isActive(i)) aliveSlots.push_back(i);
+        }
         
         // Se evasão de colisão está ativa, usa o Strategy (RVO2)
-        if (collisionAvoidanceEnabled && collisionAvoidance && collisionAvoidance->isActive() && !aliveAgents.empty()) {
+        if (collisionAvoidanceEnabled && collisionAvoidance && collisionAvoidance->isActive() && !aliveSlots.empty()) {
             // Mede tempo do algoritmo de evasão
             auto startTime = std::chrono::high_resolution_clock::now();
-            updateWithCollisionAvoidance(aliveAgents, deltaTime);
+            updateWithCollisionAvoidance(aliveSlots, deltaTime);
             auto endTime = std::chrono::high_resolution_clock::now();
             double elapsedMs = std::chrono::duration<double, std::milli>(endTime - startTime).count();
             totalAvoidanceTimeMs += elapsedMs;
             avoidanceFrameCount++;
             
             // Conta colisões reais entre agentes (para verificar qualidade do método)
-            countCollisions(aliveAgents);
+            countCollisions(aliveSlots);
+        } else if (cooperativePlanner || flowFieldCache || replanChanges) {
+            // Planos, campos e D* Lite são caches compartilhados: serial
+            for (uint32_t i = 0; i < store.size(); ++i) {
+                updateAgent(i, deltaTime);
+            }
         } else {
-            // Atualiza movimento dos agentes sem evasão
-            for (auto& agent : agents) {
-                updateAgent(agent.get(), deltaTime);
+            // Seguir o caminho só escreve no próprio slot: roda em paralelo.
+            // Quem precisa pedir caminho ou chegou ao destino fica marcado e
+            // é tratado depois, em ordem de slot, pela versão serial.
+            std::vector<uint8_t> deferred(store.size(), 0);
+            getJobs().parallelFor(store.size(), UPDATE_GRAIN, [&](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    uint32_t slot = (uint32_t)i;
+                    if (!store.isActive(slot)) continue;
+                    deferred[i] = !store.has(slot, AgentStore::HAS_PATH) || !advanceAlongPath(slot, deltaTime);
+                }
+            });
+            store.touch();
+            for (uint32_t i = 0; i < deferred.size(); ++i) {
+                if (deferred[i]) updateAgent(i, deltaTime);
             }
         }
         
@@ -240,230 +1123,307 @@ public:
         // O sistema antigo (CollisionObserver::handleCollision) empurra agentes 5px,
         // o que conflita com as velocidades calculadas pelos métodos de evasão (RVO2, etc.)
         if (collisionEnabled && !(collisionAvoidanceEnabled && collisionAvoidance && collisionAvoidance->isActive())) {
-            std::vector<GameAgent*> agentPtrs;
-            for (auto& agent : agents) {
-                if (agent->isAlive() && !agent->hasReachedTarget()) {
-                    agentPtrs.push_back(agent.get());
-                }
+            std::vector<uint32_t> activeSlots;
+            for (uint32_t i = 0; i < store.size(); ++i) {
+                if (store.isActive(i)) activeSlots.push_back(i);
             }
-            CollisionManager::getInstance()->processCollisions(agentPtrs);
+            CollisionManager::getInstance()->processCollisions(handlesOf(activeSlots),
+                                                               buildProximity(activeSlots), getJobs());
         }
     }
     
+    JobSystem& getJobs() {
+        if (!jobs) jobs = std::make_unique<JobSystem>(workerThreads);
+        return *jobs;
+    }
+    
+    std::vector<GameAgent*> handlesOf(const std::vector<uint32_t>& slots) const {
+        std::vector<GameAgent*> handles;
+        handles.reserve(slots.size());
+        for (uint32_t slot : slots) handles.push_back(store.getHandle(slot));
+        return handles;
+    }
+    
+    // Índice espacial das posições atuais de `slots` (ponto i = slots[i]).
+    // Reaproveita o anterior se nada mudou no store desde então.
+    const SpatialHash& buildProximity(const std::vector<uint32_t>& slots) {
+        if (proximityRevision == store.getRevision() && proximitySlots == slots) return proximity;
+        std::vector<Vector2> positions;
+        positions.reserve(slots.size());
+        for (uint32_t slot : slots) positions.push_back(store.getPosition(slot));
+        proximity.build(std::move(positions), getProximityCellSize());
+        proximitySlots = slots;
+        proximityRevision = store.getRevision();
+        return proximity;
+    }
+    
+    // Maior distância consultada: pares de colisão/aviso e sensores da evasão
+    float getProximityCellSize() const {
+        auto* cm = CollisionManager::getInstance();
+        return 2.0f * std::max({collisionDetectionRadius, cm->getWarningRadius(), cm->getCollisionRadius()});
+    }
+    
     // Atualiza agentes usando o Strategy de evasão de colisão (RVO2)
-    void updateWithCollisionAvoidance(std::vector<GameAgent*>& aliveAgents, float deltaTime) {
+    void updateWithCollisionAvoidance(const std::vector<uint32_t>& aliveSlots, float deltaTime) {
         // 1. Sincroniza posições dos agentes com o simulador RVO2
-        collisionAvoidance->syncAgents(aliveAgents);
+        std::vector<GameAgent*> aliveAgents = handlesOf(aliveSlots);
+        collisionAvoidance->syncAgents(aliveAgents, buildProximity(aliveSlots));
         
         // 2. Calcula velocidades desejadas (direção ao próximo waypoint do path)
-        std::vector<Vector2> preferredVelocities;
-        preferredVelocities.reserve(aliveAgents.size());
-        
-        for (auto* agent : aliveAgents) {
-            Vector2 prefVel = {0.0f, 0.0f};
-            
-            if (!agent->getHasPath()) {
-                // Tenta encontrar caminho
-                Cell gridCell = worldToGrid(agent->getPosition());
-                Vector2 startGrid = {(float)gridCell.x, (float)gridCell.y};
-                auto newPath = findPath(startGrid, agent->getTarget());
-                
-                if (!newPath.empty()) {
-                    agent->setPath(newPath);
-                } else {
-                    agent->pathBlocked();
-                }
+        //    Seguindo caminho, em paralelo; pedir caminho e chegar ao destino
+        //    (buscas e observers) ficam para o passo serial logo depois
+        std::vector<Vector2> preferredVelocities(aliveSlots.size(), {0.0f, 0.0f});
+        if (cooperativePlanner || flowFieldCache || replanChanges) {
+            for (size_t i = 0; i < aliveSlots.size(); ++i) {
+                preferredVelocities[i] = preferredVelocity(aliveSlots[i]);
             }
-            
-            if (agent->getHasPath()) {
-                const auto& path = agent->getPath();
-                int currentIdx = agent->getCurrentPathIndex();
-                
-                if (currentIdx < (int)path.size()) {
-                    Vector2 nextCell = path[currentIdx];
-                    Vector2 targetWorldPos = gridToWorld((int)nextCell.x, (int)nextCell.y);
-                    
-                    Vector2 pos = agent->getPosition();
-                    Vector2 direction = {targetWorldPos.x - pos.x, targetWorldPos.y - pos.y};
-                    float distance = std::sqrt(direction.x * direction.x + direction.y * direction.y);
-                    
-                    if (distance < 5.0f) {
-                        agent->setCurrentPathIndex(currentIdx + 1);
-                        // Recalcula para o próximo waypoint
-                        if (currentIdx + 1 < (int)path.size()) {
-                            nextCell = path[currentIdx + 1];
-                            targetWorldPos = gridToWorld((int)nextCell.x, (int)nextCell.y);
-                            direction = {targetWorldPos.x - pos.x, targetWorldPos.y - pos.y};
-                            distance = std::sqrt(direction.x * direction.x + direction.y * direction.y);
-                        } else {
-                            distance = 0.0f;
-                        }
-                    }
-                    
-                    if (distance > 0.001f) {
-                        // Velocidade desejada = direção normalizada * velocidade do agente
-                        prefVel.x = (direction.x / distance) * agent->getSpeed();
-                        prefVel.y = (direction.y / distance) * agent->getSpeed();
-                    }
-                } else {
-                    agent->setHasPath(false);
-                    agent->reachTarget();
+        } else {
+            std::vector<uint8_t> deferred(aliveSlots.size(), 0);
+            getJobs().parallelFor(aliveSlots.size(), UPDATE_GRAIN, [&](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    deferred[i] = !followPath(aliveSlots[i], preferredVelocities[i]);
                 }
+            });
+            for (size_t i = 0; i < aliveSlots.size(); ++i) {
+                if (deferred[i]) preferredVelocities[i] = preferredVelocity(aliveSlots[i]);
             }
-            
-            preferredVelocities.push_back(prefVel);
         }
         
         // 3. Envia velocidades desejadas ao RVO2
         collisionAvoidance->setPreferredVelocities(aliveAgents, preferredVelocities);
         
         // 4. RVO2 calcula velocidades corrigidas (com evasão)
-        collisionAvoidance->doStep();
+        collisionAvoidance->doStep(getJobs());
         
         // 5. Aplica velocidades corrigidas aos agentes
         auto correctedVelocities = collisionAvoidance->getCorrectedVelocities();
         
-        for (size_t i = 0; i < aliveAgents.size() && i < correctedVelocities.size(); ++i) {
-            GameAgent* agent = aliveAgents[i];
-            Vector2 vel = correctedVelocities[i];
-            
-            // Aplica a velocidade corrigida pelo RVO2
-            Vector2 pos = agent->getPosition();
-            Vector2 newPos = {
-                pos.x + vel.x * deltaTime * 60.0f,
-                pos.y + vel.y * deltaTime * 60.0f
-            };
-            agent->setPosition(newPos);
+        size_t count = std::min(aliveSlots.size(), correctedVelocities.size());
+        getJobs().parallelFor(count, UPDATE_GRAIN, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                Vector2 vel = correctedVelocities[i];
+                Vector2 pos = store.getPosition(aliveSlots[i]);
+                store.integrate(aliveSlots[i], {pos.x + vel.x * deltaTime * 60.0f,
+                                                pos.y + vel.y * deltaTime * 60.0f});
+            }
+        });
+        store.touch();
+    }
+    
+    // Vetor da posição `pos` até o centro do waypoint atual do slot
+    Vector2 toWaypoint(uint32_t slot, Vector2 pos) const {
+        Vector2 cell = store.getWaypoint(slot);
+        Vector2 targetWorldPos = gridToWorld((int)cell.x, (int)cell.y);
+        return {targetWorldPos.x - pos.x, targetWorldPos.y - pos.y};
+    }
+    
+    // Velocidade desejada (sem evasão) do slot, versão serial: pede caminho
+    // e marca a chegada ao destino quando preciso
+    Vector2 preferredVelocity(uint32_t slot) {
+        if (cooperativePlanner) return cooperativeVelocity(store.getHandle(slot));
+        if (flowFieldCache) return flowFieldVelocity(store.getHandle(slot));
+        if (replanChanges) return incrementalVelocity(store.getHandle(slot));
+        
+        if (!store.has(slot, AgentStore::HAS_PATH)) {
+            // Tenta encontrar caminho
+            requestPath(store.getHandle(slot));
+            if (!store.has(slot, AgentStore::HAS_PATH)) return {0.0f, 0.0f};
         }
+        
+        Vector2 velocity;
+        if (followPath(slot, velocity)) return velocity;
+        
+        GameAgent* agent = store.getHandle(slot);
+        agent->setHasPath(false);
+        agent->reachTarget();
+        return {0.0f, 0.0f};
     }
     
-    void updateAgent(GameAgent* agent, float deltaTime) {
-        if (!agent->isAlive()) return;
-        if (agent->hasReachedTarget()) return;  // Já chegou ao destino
+    // Direção ao waypoint atual (trocando de waypoint ao chegar perto). Só
+    // escreve no próprio slot, então pode rodar em paralelo; devolve false
+    // sem mexer em nada se o slot não tem caminho ou já passou do último
+    // waypoint.
+    bool followPath(uint32_t slot, Vector2& velocity) {
+        velocity = {0.0f, 0.0f};
+        if (!store.has(slot, AgentStore::HAS_PATH)) return false;
         
-        if (!agent->getHasPath()) {
-            // Converte posição do agente para coordenadas do grid
-            Cell gridCell = worldToGrid(agent->getPosition());
-            Vector2 startGrid = {(float)gridCell.x, (float)gridCell.y};
-            
-            auto newPath = findPath(startGrid, agent->getTarget());
-            
-            if (newPath.empty()) {
-                agent->pathBlocked();
-                return;
+        int currentIdx = store.getPathIndex(slot);
+        if (currentIdx >= store.getPathLength(slot)) return false;
+        
+        Vector2 pos = store.getPosition(slot);
+        Vector2 direction = toWaypoint(slot, pos);
+        float distance = std::sqrt(direction.x * direction.x + direction.y * direction.y);
+        
+        if (distance < 5.0f) {
+            store.getHandle(slot)->setCurrentPathIndex(currentIdx + 1);
+            // Recalcula para o próximo waypoint
+            if (currentIdx + 1 < store.getPathLength(slot)) {
+                direction = toWaypoint(slot, pos);
+                distance = std::sqrt(direction.x * direction.x + direction.y * direction.y);
+            } else {
+                distance = 0.0f;
             }
-            
-            agent->setPath(newPath);
-            return;
         }
         
-        const auto& path = agent->getPath();
-        int currentIdx = agent->getCurrentPathIndex();
+        if (distance > 0.001f) {
+            // Velocidade desejada = direção normalizada * velocidade do agente
+            float speed = store.getSpeed(slot);
+            velocity = {(direction.x / distance) * speed, (direction.y / distance) * speed};
+        }
+        return true;
+    }
+    
+    // Um passo ao longo do caminho (ou a troca de waypoint), só no próprio
+    // slot e sem mudar a revisão do store: seguro em paralelo, com
+    // store.touch() depois. Devolve false se o caminho já terminou.
+    bool advanceAlongPath(uint32_t slot, float deltaTime) {
+        int currentIdx = store.getPathIndex(slot);
+        if (currentIdx >= store.getPathLength(slot)) return false;
+        
+        Vector2 pos = store.getPosition(slot);
+        Vector2 direction = toWaypoint(slot, pos);
+        float distance = std::sqrt(direction.x * direction.x + direction.y * direction.y);
         
-        if (currentIdx < (int)path.size()) {
-            Vector2 nextCell = path[currentIdx];
-            Vector2 targetWorldPos = gridToWorld((int)nextCell.x, (int)nextCell.y);
-            
-            Vector2 pos = agent->getPosition();
-            Vector2 direction = {targetWorldPos.x - pos.x, targetWorldPos.y - pos.y};
-            float distance = std::sqrt(direction.x * direction.x + direction.y * direction.y);
+        if (distance < 5.0f) {
+            store.getHandle(slot)->setCurrentPathIndex(currentIdx + 1);
+        } else {
+            direction.x /= distance;
+            direction.y /= distance;
             
-            if (distance < 5.0f) {
-                agent->setCurrentPathIndex(currentIdx + 1);
-            } else {
-                direction.x /= distance;
-                direction.y /= distance;
-                
-                Vector2 newPos = {
-                    pos.x + direction.x * agent->getSpeed() * deltaTime * 60.0f,
-                    pos.y + direction.y * agent->getSpeed() * deltaTime * 60.0f
-                };
-                agent->setPosition(newPos);
+            float speed = store.getSpeed(slot);
+            store.integrate(slot, {pos.x + direction.x * speed * deltaTime * 60.0f,
+                                   pos.y + direction.y * speed * deltaTime * 60.0f});
+        }
+        return true;
+    }
+    
+    // Versão serial: modos com caches compartilhados e os slots adiados
+    void updateAgent(uint32_t slot, float deltaTime) {
+        if (!store.isActive(slot)) return;  // Morto ou já chegou ao destino
+        
+        if (cooperativePlanner || flowFieldCache || replanChanges) {
+            GameAgent* agent = store.getHandle(slot);
+            Vector2 vel = cooperativePlanner ? cooperativeVelocity(agent) :
+                flowFieldCache ? flowFieldVelocity(agent) : incrementalVelocity(agent);
+            if (vel.x != 0.0f || vel.y != 0.0f) {
+                Vector2 pos = store.getPosition(slot);
+                store.moveTo(slot, {pos.x + vel.x * deltaTime * 60.0f,
+                                    pos.y + vel.y * deltaTime * 60.0f});
             }
+            return;
+        }
+        
+        if (!store.has(slot, AgentStore::HAS_PATH)) {
+            requestPath(store.getHandle(slot));
+            return;
+        }
+        
+        if (advanceAlongPath(slot, deltaTime)) {
+            store.touch();
         } else {
-            if (agent->getHasPath()) {
-                agent->setHasPath(false);
-                agent->reachTarget();
+            GameAgent* agent = store.getHandle(slot);
+            agent->setHasPath(false);
+            agent->reachTarget();
+        }
+    }
+    
+    // Slots ativos perto da câmera (`margin` além da borda), em ordem. Se o
+    // índice espacial do frame ainda vale, só as células visíveis são
+    // percorridas; senão, uma passada linear pelo store.
+    std::vector<uint32_t> visibleSlots(float margin) const {
+        std::vector<uint32_t> slots;
+        if (viewport.width > 0.0f && proximityRevision == store.getRevision()) {
+            std::vector<uint32_t> points;
+            proximity.queryRect({viewport.x - margin, viewport.y - margin,
+                                 viewport.width + 2.0f * margin, viewport.height + 2.0f * margin}, points);
+            for (uint32_t point : points) {
+                if (store.isActive(proximitySlots[point])) slots.push_back(proximitySlots[point]);
             }
+            return slots;
+        }
+        for (uint32_t i = 0; i < store.size(); ++i) {
+            if (store.isActive(i) && isInViewport(store.getPosition(i), margin)) slots.push_back(i);
         }
+        return slots;
     }
     
-    void drawAll() {
-        for (auto& agent : agents) {
-            if (!agent->isAlive()) continue;
-            if (agent->hasReachedTarget()) continue;  // Agente chegou ao destino - não desenha
-            
-            Vector2 pos = agent->getPosition();
+    // Percorre os arrays do store só para os agentes visíveis; mortos e os
+    // que chegaram ao destino não são desenhados. `alpha`: fração do passo
+    // fixo já decorrida desde o último updateAll (interpola as posições).
+    void drawAll(float alpha = 1.0f) {
+        auto* hexAdapter = gridType == GridType::HEXAGONAL ?
+            dynamic_cast<HexagonalGridAdapter*>(gridAdapter) : nullptr;
+        float hexRadius = hexAdapter ? hexAdapter->GetHexRadius() - 2 : 0.0f;
+        float radius = gridAdapter->GetCellSize() / 3.0f;
+        float margin = (hexAdapter ? hexRadius : radius) + 12.0f;  // Corpo + barra de vida
+        if (collisionEnabled) {
+            margin = std::max(margin, CollisionManager::getInstance()->getWarningRadius());
+        }
+        std::vector<uint32_t> visible = visibleSlots(margin);
+        
+        for (uint32_t i : visible) {
+            Vector2 pos = store.getInterpolatedPosition(i, alpha);
+            float healthPercent = (float)store.getHealth(i) / store.getMaxHealth(i);
+            Color healthColor = (healthPercent > 0.5f) ? GREEN : (healthPercent > 0.25f) ? YELLOW : RED;
             
             if (gridType == GridType::HEXAGONAL) {
                 // Desenha agente como hexágono
-                auto* hexAdapter = dynamic_cast<HexagonalGridAdapter*>(gridAdapter);
                 if (hexAdapter) {
-                    float hexRadius = hexAdapter->GetHexRadius() - 2;
                     // Hexágono preenchido com cor do agente
-                    DrawPoly(pos, 6, hexRadius, 0.0f, agent->getColor());
+                    DrawPoly(pos, 6, hexRadius, 0.0f, store.getColor(i));
                     // Borda do hexágono
                     DrawPolyLines(pos, 6, hexRadius, 0.0f, BLACK);
                     
                     // Desenha barra de vida
                     float healthBarWidth = hexRadius * 2.0f;
                     float healthBarHeight = 3;
-                    float healthPercent = (float)agent->getHealth() / agent->getMaxHealth();
                     
                     DrawRectangle(
-                        pos.x - healthBarWidth / 2, 
-                        pos.y - hexRadius - 6, 
-                        healthBarWidth, 
-                        healthBarHeight, 
+                        pos.x - healthBarWidth / 2,
+                        pos.y - hexRadius - 6,
+                        healthBarWidth,
+                        healthBarHeight,
                         DARKGRAY
                     );
                     DrawRectangle(
-                        pos.x - healthBarWidth / 2, 
-                        pos.y - hexRadius - 6, 
-                        healthBarWidth * healthPercent, 
-                        healthBarHeight, 
-                        (healthPercent > 0.5f) ? GREEN : (healthPercent > 0.25f) ? YELLOW : RED
+                        pos.x - healthBarWidth / 2,
+                        pos.y - hexRadius - 6,
+                        healthBarWidth * healthPercent,
+                        healthBarHeight,
+                        healthColor
                     );
                 }
             } else {
                 // Desenha agente como círculo (grid retangular)
-                float radius = gridAdapter->GetCellSize() / 3.0f;
-                DrawCircle(pos.x, pos.y, radius, agent->getColor());
+                DrawCircle(pos.x, pos.y, radius, store.getColor(i));
                 
                 // Desenha barra de vida
                 float healthBarWidth = radius * 2.5f;
                 float healthBarHeight = 4;
-                float healthPercent = (float)agent->getHealth() / agent->getMaxHealth();
                 
                 DrawRectangle(
-                    pos.x - healthBarWidth / 2, 
-                    pos.y - radius - 10, 
-                    healthBarWidth, 
-                    healthBarHeight, 
+                    pos.x - healthBarWidth / 2,
+                    pos.y - radius - 10,
+                    healthBarWidth,
+                    healthBarHeight,
                     DARKGRAY
                 );
                 DrawRectangle(
-                    pos.x - healthBarWidth / 2, 
-                    pos.y - radius - 10, 
-                    healthBarWidth * healthPercent, 
-                    healthBarHeight, 
-                    (healthPercent > 0.5f) ? GREEN : (healthPercent > 0.25f) ? YELLOW : RED
+                    pos.x - healthBarWidth / 2,
+                    pos.y - radius - 10,
+                    healthBarWidth * healthPercent,
+                    healthBarHeight,
+                    healthColor
                 );
             }
         }
         
         // Desenha zonas de colisão se habilitado
         if (collisionEnabled) {
-            std::vector<GameAgent*> agentPtrs;
-            for (auto& agent : agents) {
-                if (agent->isAlive() && !agent->hasReachedTarget()) {
-                    agentPtrs.push_back(agent.get());
-                }
-            }
-            CollisionManager::getInstance()->drawCollisionZones(agentPtrs);
+            CollisionManager::getInstance()->drawCollisionZones(handlesOf(visible));
         }
     }
-    
+
     // Causa dano a um agente específico (para testes)
     void damageAgent(int index, int damage) {
         if (index >= 0 && index < (int)agents.size()) {
@@ -500,27 +1460,30 @@ public:
     // Conta colisões reais (únicas por par de agentes) — para medir qualidade do método
     // Incrementa o contador apenas quando dois agentes COMEÇAM a colidir,
     // não a cada frame que estão sobrepostos
-    void countCollisions(const std::vector<GameAgent*>& aliveAgents) {
+    void countCollisions(const std::vector<uint32_t>& aliveSlots) {
         float radius = collisionDetectionRadius;
         std::set<std::pair<GameAgent*, GameAgent*>> currentPairs;
         
-        for (size_t i = 0; i < aliveAgents.size(); ++i) {
-            for (size_t j = i + 1; j < aliveAgents.size(); ++j) {
-                Vector2 p1 = aliveAgents[i]->getPosition();
-                Vector2 p2 = aliveAgents[j]->getPosition();
-                float dx = p2.x - p1.x;
-                float dy = p2.y - p1.y;
-                float dist = std::sqrt(dx * dx + dy * dy);
-                if (dist < radius * 2.0f) {
-                    auto pair = std::make_pair(
-                        std::min(aliveAgents[i], aliveAgents[j]),
-                        std::max(aliveAgents[i], aliveAgents[j]));
-                    currentPairs.insert(pair);
-                    // Só conta se é uma colisão NOVA (não existia no frame anterior)
-                    if (activeCollisionPairs.find(pair) == activeCollisionPairs.end()) {
-                        collisionCount++;
-                    }
-                }
+        // Pares buscados em paralelo por blocos de pontos; concatenados na
+        // ordem dos blocos, saem na mesma ordem da busca serial
+        const SpatialHash& index = buildProximity(aliveSlots);
+        size_t chunks = (index.size() + PAIR_GRAIN - 1) / PAIR_GRAIN;
+        std::vector<std::vector<SpatialHash::Pair>> chunkPairs(chunks);
+        getJobs().parallelFor(index.size(), PAIR_GRAIN, [&](size_t begin, size_t end) {
+            index.findPairs(radius * 2.0f, begin, end, chunkPairs[begin / PAIR_GRAIN]);
+        });
+        std::vector<SpatialHash::Pair> pairs;
+        for (const auto& chunk : chunkPairs) {
+            pairs.insert(pairs.end(), chunk.begin(), chunk.end());
+        }
+        for (const auto& near : pairs) {
+            GameAgent* a = store.getHandle(aliveSlots[near.first]);
+            GameAgent* b = store.getHandle(aliveSlots[near.second]);
+            auto pair = std::make_pair(std::min(a, b), std::max(a, b));
+            currentPairs.insert(pair);
+            // Só conta se é uma colisão NOVA (não existia no frame anterior)
+            if (activeCollisionPairs.find(pair) == activeCollisionPairs.end()) {
+                collisionCount++;
             }
         }
         activeCollisionPairs = currentPairs;
@@ -535,12 +1498,34 @@ public:
     // Total de colisões detectadas
     int getCollisionCount() const { return collisionCount; }
     
+    // Média de nós expandidos por busca (grid retangular) — compara A* x JPS
+    double getAverageExpandedNodes() const {
+        if (pathQueryCount == 0) return 0.0;
+        return (double)totalExpandedNodes / pathQueryCount;
+    }
+    
+    // Média de waypoints por caminho entregue — cai com a suavização
+    double getAverageWaypoints() const {
+        if (assignedPathCount == 0) return 0.0;
+        return (double)totalWaypoints / assignedPathCount;
+    }
+    
     // Reseta métricas para nova bateria de testes
+    // O cache de caminhos também é esvaziado: cada medição começa a frio,
+    // senão testes com a mesma população (benchmark com semente) recebem os
+    // caminhos do teste anterior e não contam nós expandidos
     void resetMetrics() {
+        pathCache->clear();
         collisionCount = 0;
         totalAvoidanceTimeMs = 0.0;
         avoidanceFrameCount = 0;
         activeCollisionPairs.clear();
+        totalExpandedNodes = 0;
+        pathQueryCount = 0;
+        totalWaypoints = 0;
+        assignedPathCount = 0;
+        pathCache->resetCounters();
+        if (pathScheduler) pathScheduler->resetCounters();
     }
     
     // Calcula distância extra média percorrida por todos os agentes
@@ -558,11 +1543,8 @@ public:
     
     // Verifica se todos os agentes chegaram ao destino
     bool allAgentsReachedTarget() const {
-        if (agents.empty()) return true;
-        for (const auto& agent : agents) {
-            if (agent->isAlive() && !agent->hasReachedTarget()) {
-                return false;
-            }
+        for (uint32_t i = 0; i < store.size(); ++i) {
+            if (store.isActive(i)) return false;
         }
         return true;
     }
@@ -570,15 +1552,28 @@ public:
     // Quantidade de agentes que chegaram ao destino
     int getReachedTargetCount() const {
         int count = 0;
-        for (const auto& agent : agents) {
-            if (agent->hasReachedTarget()) count++;
+        for (uint32_t i = 0; i < store.size(); ++i) {
+            if (store.has(i, AgentStore::REACHED_TARGET)) count++;
         }
         return count;
     }
     
     // Remove todos os agentes (para reset entre testes)
+    // Solta tudo o que referencia os agentes (campos, planos cooperativos,
+    // buscas pendentes) antes de destruí-los, como removeAgent
     void clearAllAgents() {
-        agents.clear();
+        for (auto& agent : agents) {
+            releaseFlowField(agent.get());
+            forgetCooperativePlan(agent.get());
+            forgetPendingPath(agent.get());
+        }
+        releaseAgents();
+    }
+    
+    // Destrói os handles do último para o primeiro: cada remoção é o último
+    // slot do store, sem deslocar os demais
+    void releaseAgents() {
+        while (!agents.empty()) agents.pop_back();
     }
     
     // Calcula a distância ideal (linha reta) para cada agente após spawn
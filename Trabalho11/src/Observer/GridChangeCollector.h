@@ -0,0 +1,47 @@
+#ifndef GRID_CHANGE_COLLECTOR_H
+#define GRID_CHANGE_COLLECTOR_H
+
+#include "src/Interfaces/IGridAdapter.h"
+#include "src/Core/GridChangeJournal.h"
+#include "src/Core/Cell.h"
+#include <vector>
+#include <cstdint>
+
+// Cursor sobre o GridChangeJournal de um grid: take() devolve as células
+// alteradas desde o último take (as regiões de lote viram suas células).
+// Útil para quem processa as mudanças em lote, uma vez por frame — não
+// precisa estar registrado em nenhum notifier.
+class GridChangeCollector {
+private:
+    IGridAdapter* grid;
+    uint64_t cursor;
+    std::vector<GridChangeRecord> records;
+
+public:
+    explicit GridChangeCollector(IGridAdapter* g)
+        : grid(g), cursor(g->getJournal().getVersion()) {}
+
+    bool hasChanges() const { return grid->getJournal().getVersion() != cursor; }
+
+    // `complete` fica false se o diário já descartou parte das alterações;
+    // nesse caso o consumidor deve reconstruir o que deriva do mapa
+    std::vector<Cell> take(bool* complete = nullptr) {
+        const GridChangeJournal& journal = grid->getJournal();
+        records.clear();
+        bool ok = journal.changesSince(cursor, records);
+        cursor = journal.getVersion();
+        if (complete) *complete = ok;
+
+        std::vector<Cell> taken;
+        for (const auto& record : records) {
+            for (int y = record.area.y0; y <= record.area.y1; ++y) {
+                for (int x = record.area.x0; x <= record.area.x1; ++x) {
+                    taken.push_back({x, y});
+                }
+            }
+        }
+        return taken;
+    }
+};
+
+#endif // GRID_CHANGE_COLLECTOR_H
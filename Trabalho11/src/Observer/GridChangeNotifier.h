@@ -0,0 +1,112 @@
+#ifndef GRID_CHANGE_NOTIFIER_H
+#define GRID_CHANGE_NOTIFIER_H
+
+#include "src/Interfaces/IObserver.h"
+#include "src/Interfaces/IGridAdapter.h"
+#include "src/Core/GridChangeJournal.h"
+#include <vector>
+#include <string>
+#include <algorithm>
+
+// Eventos de alteração do mapa
+namespace GridEvents {
+    const std::string OBSTACLE_CHANGED = "grid_obstacle_changed";
+    const std::string REGION_CHANGED = "grid_region_changed";    // Edição em lote (GridRegionData)
+    const std::string GRID_REPLACED = "grid_replaced";           // Mapa novo (GridReplacedData)
+}
+
+// Dados de uma célula alterada (enviados junto com OBSTACLE_CHANGED)
+struct GridChangeData {
+    IGridAdapter* grid;
+    int x;
+    int y;
+    bool isObstacle;
+};
+
+// Dados de uma edição em lote (enviados junto com REGION_CHANGED). As células
+// dentro de `area` podem ter mudado em qualquer sentido; o estado atual está
+// no próprio grid.
+struct GridRegionData {
+    IGridAdapter* grid;
+    GridRect area;
+    bool cleared;   // Alguma célula da área foi liberada
+};
+
+// Dados de uma troca de mapa (enviados junto com GRID_REPLACED). O grid
+// `previous` já foi destruído: o ponteiro só serve para comparar. Quem tem
+// estruturas derivadas dele as descarta e para de reagir a eventos (outro
+// grid pode reaproveitar o endereço).
+struct GridReplacedData {
+    IGridAdapter* previous;
+    IGridAdapter* grid;
+};
+
+// Singleton - Publica alterações de obstáculos para quem mantém estruturas
+// derivadas do mapa (hierarquias de busca, caches, etc.). Quem prefere
+// consultar em vez de ser avisado lê o GridChangeJournal do grid.
+class GridChangeNotifier : public ISubject {
+private:
+    static GridChangeNotifier* instance;
+    std::vector<IObserver*> observers;
+
+    GridChangeNotifier() = default;
+
+public:
+    GridChangeNotifier(const GridChangeNotifier&) = delete;
+    GridChangeNotifier& operator=(const GridChangeNotifier&) = delete;
+
+    static GridChangeNotifier* getInstance() {
+        if (!instance) {
+            instance = new GridChangeNotifier();
+        }
+        return instance;
+    }
+
+    void addObserver(IObserver* observer) override {
+        observers.push_back(observer);
+    }
+
+    void removeObserver(IObserver* observer) override {
+        observers.erase(
+            std::remove(observers.begin(), observers.end(), observer),
+            observers.end()
+        );
+    }
+
+    void notifyObservers(const std::string& event, void* data = nullptr) override {
+        for (auto* observer : observers) {
+            observer->onNotify(event, data);
+        }
+    }
+
+    // Atalho para publicar a alteração de uma célula
+    void cellChanged(IGridAdapter* grid, int x, int y, bool isObstacle) {
+        GridChangeData data = {grid, x, y, isObstacle};
+        notifyObservers(GridEvents::OBSTACLE_CHANGED, &data);
+    }
+
+    // Aplica `edit` (uma série de SetObstacle) como um lote: o diário ganha
+    // uma única entrada e os observers recebem um único REGION_CHANGED com a
+    // caixa das células alteradas, em vez de um evento por célula
+    template <typename EditFn>
+    void bulkEdit(IGridAdapter* grid, EditFn&& edit) {
+        GridChangeJournal& journal = grid->getJournal();
+        journal.beginBulk();
+        edit();
+        GridRegionData data = {grid, GridRect(), false};
+        if (journal.endBulk(data.area)) {
+            data.cleared = journal.getLastClearVersion() == journal.getVersion();
+            notifyObservers(GridEvents::REGION_CHANGED, &data);
+        }
+    }
+
+    // O mapa ativo foi substituído (GridManager::switchGrid)
+    void gridReplaced(IGridAdapter* previous, IGridAdapter* grid) {
+        GridReplacedData data = {previous, grid};
+        notifyObservers(GridEvents::GRID_REPLACED, &data);
+    }
+};
+
+inline GridChangeNotifier* GridChangeNotifier::instance = nullptr;
+
+#endif // GRID_CHANGE_NOTIFIER_H
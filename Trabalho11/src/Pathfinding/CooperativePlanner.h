@@ -0,0 +1,321 @@
+#ifndef COOPERATIVE_PLANNER_H
+#define COOPERATIVE_PLANNER_H
+
+#include "src/Pathfinding/ReservationTable.h"
+#include "src/Pathfinding/FlowFieldCache.h"
+#include "src/Pathfinding/GridTopology.h"
+#include "src/Interfaces/IGridAdapter.h"
+#include "src/Interfaces/IObserver.h"
+#include "src/Observer/GridChangeNotifier.h"
+#include "src/Core/Cell.h"
+#include "src/Core/GridType.h"
+#include <vector>
+#include <unordered_set>
+#include <algorithm>
+#include <functional>
+#include <cstdint>
+
+// =============================================================================
+// CooperativePlanner — Busca cooperativa em janela (WHCA*)
+// =============================================================================
+// Com A* independente, dois agentes num corredor planejam o mesmo caminho em
+// sentidos opostos e o conflito fica para a evasão de colisão resolver. Aqui
+// os agentes planejam em espaço-tempo sobre uma ReservationTable comum:
+//   - estado = (célula, passo); ações = ir a um vizinho ou esperar, custo 1;
+//   - cada plano reserva as células por passo, e os seguintes desviam delas
+//     (conflitos de vértice e de troca de células);
+//   - a busca só olha `window` passos à frente; além da janela a estimativa é
+//     a distância real até o destino ignorando os outros agentes, lida do
+//     FlowField do destino (a abstração "hierárquica" do HCA*, reparada
+//     incrementalmente quando o mapa muda);
+//   - cada agente replaneja a cada window/2 passos, quando sai do plano ou
+//     quando uma célula do seu plano vira obstáculo.
+//
+// Tempo discreto em passos "lockstep": o passo avança quando todos os agentes
+// chegaram à célula do passo seguinte (ou esgotou o tempo máximo do passo,
+// para um agente empurrado não travar os outros). O gerenciador informa a
+// posição de cada agente com reportPosition() e chama update() por frame.
+// =============================================================================
+class CooperativePlanner : public IObserver {
+public:
+    static constexpr int INVALID_AGENT = -1;
+
+private:
+    struct Plan {
+        bool active = false;
+        Cell goal = {0, 0};
+        FlowField* field = nullptr;
+        std::vector<Cell> cells;  // cells[k] = célula no passo start + k
+        uint32_t start = 0;
+        Cell position = {0, 0};   // Célula real (informada pelo gerenciador)
+        bool arrived = false;     // Já está na célula do passo seguinte
+        bool stale = false;       // Uma célula do plano virou obstáculo
+    };
+
+    struct StateNode {
+        Cell cell;
+        int depth;
+        int parent;
+    };
+
+    struct OpenEntry {
+        float f;
+        int depth;
+        int node;
+        // Heap mínimo por f; no empate, o mais profundo primeiro
+        bool operator>(const OpenEntry& other) const {
+            if (f != other.f) return f > other.f;
+            return depth < other.depth;
+        }
+    };
+
+    IGridAdapter* grid;
+    const ObstacleBitGrid* occupancy;  // Bits de obstáculo do grid (sem chamada virtual)
+    GridType gridType;
+    int window;
+    FlowFieldCache fields;
+    ReservationTable reservations;
+
+    std::vector<Plan> plans;
+    std::vector<int> freeIds;
+    int activeCount = 0;
+    uint32_t now = 0;
+    float stepTimer = 0.0f;
+
+    std::vector<StateNode> nodes;
+    std::vector<OpenEntry> open;
+    std::unordered_set<uint64_t> visited;
+    int pendingExpandedNodes = 0;  // Expansões desde o último takeExpandedNodes()
+    long long replanCount = 0;
+
+    int indexOf(Cell c) const { return c.y * grid->GetWidth() + c.x; }
+
+    Cell cellAt(const Plan& plan, uint32_t time) const {
+        if (time <= plan.start) return plan.cells.front();
+        size_t k = std::min<size_t>(time - plan.start, plan.cells.size() - 1);
+        return plan.cells[k];
+    }
+
+    void releasePlan(int id) {
+        Plan& plan = plans[id];
+        for (size_t k = 0; k < plan.cells.size(); ++k) {
+            uint32_t time = plan.start + (uint32_t)k;
+            if (time >= now) reservations.release(indexOf(plan.cells[k]), time, id);
+        }
+    }
+
+    void reservePlan(int id) {
+        Plan& plan = plans[id];
+        for (size_t k = 0; k < plan.cells.size(); ++k) {
+            reservations.reserve(indexOf(plan.cells[k]), plan.start + (uint32_t)k, id);
+        }
+    }
+
+    void pushOpen(OpenEntry entry) {
+        open.push_back(entry);
+        std::push_heap(open.begin(), open.end(), std::greater<OpenEntry>());
+    }
+
+    OpenEntry popOpen() {
+        std::pop_heap(open.begin(), open.end(), std::greater<OpenEntry>());
+        OpenEntry top = open.back();
+        open.pop_back();
+        return top;
+    }
+
+    // A* espaço-tempo de `from` (no passo atual) até o destino ou até o fim da
+    // janela. Sem saída livre, o plano é ficar parado.
+    void planWindow(int id, Cell from) {
+        Plan& plan = plans[id];
+        releasePlan(id);
+        plan.start = now;
+        plan.stale = false;
+        plan.cells.clear();
+        replanCount++;
+
+        int width = grid->GetWidth();
+        int height = grid->GetHeight();
+        uint64_t cellCount = (uint64_t)width * height;
+        FlowField* field = plan.field;
+
+        nodes.clear();
+        open.clear();
+        visited.clear();
+        nodes.push_back({from, 0, -1});
+        visited.insert((uint64_t)indexOf(from));
+        pushOpen({(float)field->getDistance(from.x, from.y), 0, 0});
+
+        int found = -1;
+        Cell adj[6];
+        while (!open.empty()) {
+            OpenEntry top = popOpen();
+            StateNode node = nodes[top.node];
+            pendingExpandedNodes++;
+            if (node.cell == plan.goal || node.depth == window) {
+                found = top.node;
+                break;
+            }
+
+            uint32_t time = now + (uint32_t)node.depth;
+            int fromIndex = indexOf(node.cell);
+            auto expand = [&](Cell next) {
+                int32_t h = field->getDistance(next.x, next.y);
+                if (h == FlowField::UNREACHABLE || !occupancy->isWalkable(next.x, next.y)) return;
+                int toIndex = indexOf(next);
+                if (!reservations.canMove(fromIndex, toIndex, time, id)) return;
+                int depth = node.depth + 1;
+                if (!visited.insert((uint64_t)depth * cellCount + toIndex).second) return;
+                nodes.push_back({next, depth, top.node});
+                pushOpen({(float)(depth + h), depth, (int)nodes.size() - 1});
+            };
+
+            expand(node.cell);  // Esperar
+            int count = GridTopology::neighbors(gridType, node.cell.x, node.cell.y, width, height, adj);
+            for (int i = 0; i < count; ++i) expand(adj[i]);
+        }
+
+        if (found == -1) {
+            plan.cells.push_back(from);
+        } else {
+            for (int index = found; index != -1; index = nodes[index].parent) {
+                plan.cells.push_back(nodes[index].cell);
+            }
+            std::reverse(plan.cells.begin(), plan.cells.end());
+        }
+        reservePlan(id);
+    }
+
+    // Avança um passo e replaneja quem precisa (a ordem gira a cada passo,
+    // para nenhum agente ter sempre a prioridade mais baixa)
+    void advance() {
+        now++;
+        stepTimer = 0.0f;
+        size_t count = plans.size();
+        for (size_t i = 0; i < count; ++i) {
+            int id = (int)((now + i) % count);
+            Plan& plan = plans[id];
+            if (!plan.active) continue;
+            plan.arrived = false;
+
+            Cell planned = cellAt(plan, now);
+            bool onPlan = plan.position == planned || plan.position == cellAt(plan, now - 1);
+            bool exhausted = now - plan.start + 1 >= plan.cells.size() && !(planned == plan.goal);
+            if (plan.stale || !onPlan || exhausted || (int)(now - plan.start) >= window / 2) {
+                // Agente empurrado para dentro de um obstáculo volta ao plano
+                bool fromPosition = !onPlan && occupancy->isWalkable(plan.position.x, plan.position.y);
+                planWindow(id, fromPosition ? plan.position : planned);
+            }
+        }
+    }
+
+public:
+    CooperativePlanner(IGridAdapter* g, GridType type, int windowSteps = 16)
+        : grid(g), occupancy(&g->getOccupancy()), gridType(type), window(std::max(2, windowSteps)),
+          fields(g, type), reservations(std::max(2, windowSteps) + 1) {}
+
+    CooperativePlanner(const CooperativePlanner&) = delete;
+    CooperativePlanner& operator=(const CooperativePlanner&) = delete;
+
+    // Registra um agente em `start` indo para `goal` e já planeja sua janela.
+    // Retorna INVALID_AGENT se o destino é inalcançável.
+    int addAgent(Cell start, Cell goal) {
+        FlowField* field = fields.acquire(goal);
+        if (!field->isReachable(start)) {
+            fields.release(field);
+            return INVALID_AGENT;
+        }
+        int id;
+        if (!freeIds.empty()) {
+            id = freeIds.back();
+            freeIds.pop_back();
+        } else {
+            id = (int)plans.size();
+            plans.emplace_back();
+        }
+        Plan& plan = plans[id];
+        plan.active = true;
+        plan.goal = goal;
+        plan.field = field;
+        plan.cells.clear();
+        plan.position = start;
+        plan.arrived = false;
+        activeCount++;
+        planWindow(id, start);
+        return id;
+    }
+
+    void removeAgent(int id) {
+        if (id < 0 || id >= (int)plans.size() || !plans[id].active) return;
+        Plan& plan = plans[id];
+        releasePlan(id);
+        fields.release(plan.field);
+        plan.field = nullptr;
+        plan.cells.clear();
+        plan.active = false;
+        freeIds.push_back(id);
+        activeCount--;
+    }
+
+    // Célula que o agente deve ocupar no próximo passo
+    Cell getNextCell(int id) const {
+        return cellAt(plans[id], now + 1);
+    }
+
+    // Posição real do agente e se ele já chegou à célula do próximo passo
+    void reportPosition(int id, Cell cell, bool arrived) {
+        plans[id].position = cell;
+        plans[id].arrived = arrived;
+    }
+
+    // Chamado uma vez por frame: avança o passo quando todos chegaram ou
+    // quando o passo durou mais que `maxStepSeconds`
+    void update(float deltaTime, float maxStepSeconds) {
+        if (activeCount == 0) return;
+        stepTimer += deltaTime;
+        bool allArrived = true;
+        for (const auto& plan : plans) {
+            if (plan.active && !plan.arrived) {
+                allArrived = false;
+                break;
+            }
+        }
+        if (allArrived || stepTimer >= maxStepSeconds) advance();
+    }
+
+    void onNotify(const std::string& event, void* data) override {
+        fields.onNotify(event, data);
+        if (!data) return;
+        GridRect blocked;
+        if (event == GridEvents::OBSTACLE_CHANGED) {
+            auto* change = static_cast<GridChangeData*>(data);
+            if (change->grid != grid || !change->isObstacle) return;
+            blocked = GridRect::cell(change->x, change->y);
+        } else if (event == GridEvents::REGION_CHANGED) {
+            auto* region = static_cast<GridRegionData*>(data);
+            if (region->grid != grid) return;
+            blocked = region->area;
+        } else {
+            return;
+        }
+
+        for (auto& plan : plans) {
+            if (!plan.active || plan.stale) continue;
+            plan.stale = std::any_of(plan.cells.begin(), plan.cells.end(),
+                [&blocked](const Cell& c) { return blocked.contains(c.x, c.y); });
+        }
+    }
+
+    int getWindow() const { return window; }
+    int getActiveAgents() const { return activeCount; }
+    uint32_t getStep() const { return now; }
+    // Expansões das buscas feitas desde a última chamada (zera o contador)
+    int takeExpandedNodes() {
+        int expanded = pendingExpandedNodes;
+        pendingExpandedNodes = 0;
+        return expanded;
+    }
+
+    long long getReplanCount() const { return replanCount; }
+};
+
+#endif // COOPERATIVE_PLANNER_H
@@ -0,0 +1,274 @@
+#ifndef DSTAR_LITE_H
+#define DSTAR_LITE_H
+
+#include "src/Interfaces/IGridAdapter.h"
+#include "src/Pathfinding/GridTopology.h"
+#include "src/Pathfinding/LandmarkTable.h"
+#include "src/Core/Cell.h"
+#include "src/Core/GridType.h"
+#include <unordered_map>
+#include <queue>
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include <functional>
+#include <memory>
+
+// =============================================================================
+// DStarLite — Replanejamento incremental (Koenig & Likhachev, versão otimizada)
+// =============================================================================
+// A busca é feita do DESTINO para a posição atual do agente. Cada célula guarda
+// g (distância conhecida até o destino) e rhs (estimativa de um passo à
+// frente); só as células inconsistentes (g != rhs) ficam na fila.
+//
+// Quando obstáculos mudam, só as células alteradas e seus vizinhos são
+// reavaliados (cellsChanged) e computeShortestPath() corrige apenas a parte da
+// árvore afetada. Quando o agente anda, moveTo() acumula km para não ter que
+// reordenar a fila. Em edição contínua do mapa o custo fica proporcional às
+// células alteradas, não à área da busca.
+//
+// Funciona nos dois grids: 4 vizinhos no retangular, 6 (odd-q) no hexagonal.
+// Estados ficam num unordered_map — só a área realmente explorada ocupa memória,
+// o que importa quando cada agente tem o seu planejador.
+//
+// A heurística (Manhattan/hexagonal ou ALT) fica fixa durante a vida do
+// planejador: as chaves na fila dependem dela, então trocar de tabela
+// significa criar outro planejador.
+// =============================================================================
+class DStarLite {
+private:
+    static constexpr float INF = std::numeric_limits<float>::infinity();
+
+    struct Key {
+        float k1;
+        float k2;
+        bool operator<(const Key& other) const {
+            return k1 < other.k1 || (k1 == other.k1 && k2 < other.k2);
+        }
+        bool operator==(const Key& other) const { return k1 == other.k1 && k2 == other.k2; }
+    };
+
+    struct State {
+        float g = INF;
+        float rhs = INF;
+        Key key = {INF, INF};
+        bool inOpen = false;
+    };
+
+    struct QueueEntry {
+        Key key;
+        int index;
+        bool operator>(const QueueEntry& other) const { return other.key < key; }
+    };
+
+    IGridAdapter* grid;
+    const ObstacleBitGrid* occupancy;  // Bits de obstáculo do grid (sem chamada virtual)
+    GridType gridType;
+    int width;
+    int height;
+    Cell start;
+    Cell last;
+    Cell goal;
+    float km = 0.0f;
+    std::unordered_map<int, State> states;
+    // Fila com remoção preguiçosa: entradas cuja chave não bate com a do
+    // estado (ou cujo estado saiu da fila) são descartadas no topo
+    std::priority_queue<QueueEntry, std::vector<QueueEntry>, std::greater<QueueEntry>> open;
+    int lastExpandedNodes = 0;
+    std::shared_ptr<const LandmarkTable> landmarks;  // Heurística ALT (opcional)
+
+    int indexOf(Cell c) const { return c.y * width + c.x; }
+    Cell cellOf(int index) const { return {index % width, index / width}; }
+
+    bool isWalkable(Cell c) const {
+        return occupancy->isWalkable(c.x, c.y);
+    }
+
+    float heuristic(Cell a, Cell b) const {
+        if (landmarks) return landmarks->estimate(a.x, a.y, b.x, b.y);
+        return gridType == GridType::HEXAGONAL ?
+            GridHeuristics::hexOddQ(a.x, a.y, b.x, b.y) :
+            GridHeuristics::manhattan(a.x, a.y, b.x, b.y);
+    }
+
+    int neighbors(Cell c, Cell out[6]) const {
+        return GridTopology::neighbors(gridType, c.x, c.y, width, height, out);
+    }
+
+    float gOf(int index) const {
+        auto it = states.find(index);
+        return it == states.end() ? INF : it->second.g;
+    }
+
+    Key calculateKey(int index, const State& s) const {
+        float m = std::min(s.g, s.rhs);
+        return {m + heuristic(start, cellOf(index)) + km, m};
+    }
+
+    void updateVertex(int index) {
+        State& s = states[index];
+        Cell u = cellOf(index);
+        if (!(u == goal)) {
+            s.rhs = INF;
+            if (isWalkable(u)) {
+                Cell adj[6];
+                int count = neighbors(u, adj);
+                for (int i = 0; i < count; ++i) {
+                    if (!isWalkable(adj[i])) continue;
+                    s.rhs = std::min(s.rhs, 1.0f + gOf(indexOf(adj[i])));
+                }
+            }
+        }
+        if (s.g != s.rhs) {
+            s.key = calculateKey(index, s);
+            s.inOpen = true;
+            open.push({s.key, index});
+        } else {
+            s.inOpen = false;
+        }
+    }
+
+    // Descarta entradas obsoletas; retorna false se a fila esvaziou
+    bool peek(QueueEntry& top) {
+        while (!open.empty()) {
+            top = open.top();
+            auto it = states.find(top.index);
+            if (it != states.end() && it->second.inOpen && it->second.key == top.key) {
+                return true;
+            }
+            open.pop();
+        }
+        return false;
+    }
+
+public:
+    DStarLite(IGridAdapter* g, GridType type, Cell startCell, Cell goalCell,
+              std::shared_ptr<const LandmarkTable> table = nullptr)
+        : grid(g), occupancy(&g->getOccupancy()), gridType(type), width(g->GetWidth()), height(g->GetHeight()),
+          start(startCell), last(startCell), goal(goalCell), landmarks(std::move(table)) {
+        State& goalState = states[indexOf(goal)];
+        goalState.rhs = 0.0f;
+        goalState.key = calculateKey(indexOf(goal), goalState);
+        goalState.inOpen = true;
+        open.push({goalState.key, indexOf(goal)});
+    }
+
+    // O agente está agora em `cell` (pode ter andado mais de uma célula)
+    void moveTo(Cell cell) {
+        if (cell == start) return;
+        start = cell;
+        km += heuristic(last, start);
+        last = start;
+    }
+
+    // Células cuja walkability mudou desde a última chamada
+    void cellsChanged(const std::vector<Cell>& cells) {
+        Cell adj[6];
+        for (const Cell& c : cells) {
+            if (c.x < 0 || c.x >= width || c.y < 0 || c.y >= height) continue;
+            updateVertex(indexOf(c));
+            int count = neighbors(c, adj);
+            for (int i = 0; i < count; ++i) {
+                updateVertex(indexOf(adj[i]));
+            }
+        }
+    }
+
+    // Torna a célula atual consistente; retorna true se o destino é alcançável.
+    // Sem mudanças pendentes, o custo é praticamente zero.
+    bool computeShortestPath() {
+        lastExpandedNodes = 0;
+        if (start.x < 0 || start.x >= width || start.y < 0 || start.y >= height) return false;
+        int startIndex = indexOf(start);
+        Cell adj[6];
+
+        while (true) {
+            QueueEntry top;
+            bool hasTop = peek(top);
+            State& startState = states[startIndex];
+            Key startKey = calculateKey(startIndex, startState);
+            if ((!hasTop || !(top.key < startKey)) && startState.rhs == startState.g) break;
+            if (!hasTop) break;
+
+            open.pop();
+            int index = top.index;
+            State& u = states[index];
+            u.inOpen = false;
+            lastExpandedNodes++;
+
+            Key newKey = calculateKey(index, u);
+            if (top.key < newKey) {
+                u.key = newKey;
+                u.inOpen = true;
+                open.push({newKey, index});
+            } else if (u.g > u.rhs) {
+                u.g = u.rhs;
+                int count = neighbors(cellOf(index), adj);
+                for (int i = 0; i < count; ++i) {
+                    updateVertex(indexOf(adj[i]));
+                }
+            } else {
+                u.g = INF;
+                updateVertex(index);
+                int count = neighbors(cellOf(index), adj);
+                for (int i = 0; i < count; ++i) {
+                    updateVertex(indexOf(adj[i]));
+                }
+            }
+        }
+        return gOf(startIndex) != INF;
+    }
+
+    // Próximo passo a partir da posição atual (vizinho livre de menor g).
+    // Retorna false no destino ou se não há caminho.
+    bool getNextCell(Cell& next) const {
+        if (start == goal) return false;
+        if (start.x < 0 || start.x >= width || start.y < 0 || start.y >= height) return false;
+        Cell adj[6];
+        int count = neighbors(start, adj);
+        float best = INF;
+        for (int i = 0; i < count; ++i) {
+            if (!isWalkable(adj[i])) continue;
+            float g = gOf(indexOf(adj[i]));
+            if (g < best) {
+                best = g;
+                next = adj[i];
+            }
+        }
+        return best != INF;
+    }
+
+    // Caminho completo seguindo g a partir da posição atual (origem e destino inclusos)
+    std::vector<Cell> extractPath() const {
+        std::vector<Cell> path;
+        if (gOf(indexOf(start)) == INF) return path;
+        Cell current = start;
+        path.push_back(current);
+        Cell adj[6];
+        while (!(current == goal) && path.size() <= (size_t)width * height) {
+            int count = neighbors(current, adj);
+            float best = INF;
+            Cell bestCell = current;
+            for (int i = 0; i < count; ++i) {
+                if (!isWalkable(adj[i])) continue;
+                float g = gOf(indexOf(adj[i]));
+                if (g < best) {
+                    best = g;
+                    bestCell = adj[i];
+                }
+            }
+            if (best == INF) return {};
+            current = bestCell;
+            path.push_back(current);
+        }
+        return path;
+    }
+
+    Cell getStart() const { return start; }
+    Cell getGoal() const { return goal; }
+    const LandmarkTable* getLandmarks() const { return landmarks.get(); }
+    int getLastExpandedNodes() const { return lastExpandedNodes; }
+    size_t getStateCount() const { return states.size(); }
+};
+
+#endif // DSTAR_LITE_H
@@ -0,0 +1,236 @@
+#ifndef FLOW_FIELD_H
+#define FLOW_FIELD_H
+
+#include "src/Interfaces/IGridAdapter.h"
+#include "src/Pathfinding/GridTopology.h"
+#include "src/Core/Cell.h"
+#include "src/Core/GridType.h"
+#include <vector>
+#include <deque>
+#include <queue>
+#include <cstdint>
+#include <functional>
+#include <utility>
+
+// =============================================================================
+// FlowField — Campo de integração (distância até um destino) sobre o grid
+// =============================================================================
+// Um único BFS a partir do destino dá a distância de TODAS as células até ele.
+// Qualquer agente indo para esse destino só precisa olhar os vizinhos da célula
+// onde está e andar para o de menor distância — O(1) por consulta, sem path
+// próprio. Com centenas de agentes indo ao mesmo alvo, isso troca centenas de
+// A* por um BFS.
+//
+// Quando um obstáculo muda, o campo é reparado localmente:
+//   - célula liberada: as distâncias só podem diminuir, basta propagar a partir
+//     dela;
+//   - célula bloqueada: as células cuja distância dependia dela (e só dela)
+//     viram "órfãs"; elas são invalidadas e recalculadas a partir da borda
+//     não afetada. O restante do campo não é tocado.
+//
+// Vizinhança: 4 direções no retangular, 6 (offset odd-q) no hexagonal — as
+// tabelas de GridTopology, sem alocar std::list por célula.
+// =============================================================================
+class FlowField {
+public:
+    static constexpr int32_t UNREACHABLE = INT32_MAX;
+
+private:
+    IGridAdapter* grid;
+    const ObstacleBitGrid* occupancy;  // Bits de obstáculo do grid (sem chamada virtual)
+    GridType gridType;
+    int width;
+    int height;
+    Cell goal;
+    std::vector<int32_t> distance;
+    std::vector<uint8_t> affected;  // Marcação temporária usada no reparo
+
+    int indexOf(int x, int y) const { return y * width + x; }
+
+    bool isWalkable(int x, int y) const {
+        return occupancy->isWalkable(x, y);
+    }
+
+    // Preenche `out` com os vizinhos dentro do mapa; retorna quantos
+    int neighbors(int x, int y, Cell out[6]) const {
+        return GridTopology::neighbors(gridType, x, y, width, height, out);
+    }
+
+    // BFS a partir das células já na fila (distâncias só diminuem)
+    void propagate(std::deque<int>& queue) {
+        Cell adj[6];
+        while (!queue.empty()) {
+            int current = queue.front();
+            queue.pop_front();
+            int cx = current % width;
+            int cy = current / width;
+            int32_t next = distance[current] + 1;
+            int count = neighbors(cx, cy, adj);
+            for (int i = 0; i < count; ++i) {
+                if (!occupancy->isWalkable(adj[i].x, adj[i].y)) continue;
+                int n = indexOf(adj[i].x, adj[i].y);
+                if (distance[n] <= next) continue;
+                distance[n] = next;
+                queue.push_back(n);
+            }
+        }
+    }
+
+public:
+    FlowField(IGridAdapter* g, GridType type, Cell target)
+        : grid(g), occupancy(&g->getOccupancy()), gridType(type), width(g->GetWidth()), height(g->GetHeight()), goal(target) {
+        build();
+    }
+
+    // Recalcula o campo inteiro
+    void build() {
+        distance.assign((size_t)width * height, UNREACHABLE);
+        affected.assign((size_t)width * height, 0);
+        if (!isWalkable(goal.x, goal.y)) return;
+
+        std::deque<int> queue;
+        int goalIndex = indexOf(goal.x, goal.y);
+        distance[goalIndex] = 0;
+        queue.push_back(goalIndex);
+        propagate(queue);
+    }
+
+    // Célula (x,y) acabou de ser liberada no grid
+    void onCellCleared(int x, int y) {
+        if (!isWalkable(x, y)) return;
+        int index = indexOf(x, y);
+
+        if (x == goal.x && y == goal.y) {
+            distance[index] = 0;
+        } else {
+            Cell adj[6];
+            int count = neighbors(x, y, adj);
+            int32_t best = UNREACHABLE;
+            for (int i = 0; i < count; ++i) {
+                int32_t d = distance[indexOf(adj[i].x, adj[i].y)];
+                if (d < best) best = d;
+            }
+            if (best == UNREACHABLE) return;  // Continua isolada
+            distance[index] = best + 1;
+        }
+
+        std::deque<int> queue;
+        queue.push_back(index);
+        propagate(queue);
+    }
+
+    // Célula (x,y) acabou de virar obstáculo no grid
+    void onCellBlocked(int x, int y) {
+        int index = indexOf(x, y);
+        if (distance[index] == UNREACHABLE) return;
+
+        // 1. Coleta as células que ficaram sem nenhum vizinho "pai" válido.
+        //    Processar por nível de distância (FIFO) garante que, ao testar uma
+        //    célula do nível d+1, todas as órfãs do nível d já estão marcadas.
+        Cell adj[6];
+        Cell adj2[6];
+        std::vector<int> orphans;
+        std::deque<int> queue;
+        affected[index] = 1;
+        orphans.push_back(index);
+        queue.push_back(index);
+
+        while (!queue.empty()) {
+            int current = queue.front();
+            queue.pop_front();
+            int32_t childDistance = distance[current] + 1;
+            int count = neighbors(current % width, current / width, adj);
+            for (int i = 0; i < count; ++i) {
+                int n = indexOf(adj[i].x, adj[i].y);
+                if (affected[n] || distance[n] != childDistance) continue;
+
+                bool supported = false;
+                int count2 = neighbors(adj[i].x, adj[i].y, adj2);
+                for (int j = 0; j < count2 && !supported; ++j) {
+                    int m = indexOf(adj2[j].x, adj2[j].y);
+                    supported = !affected[m] && distance[m] == childDistance - 1;
+                }
+                if (supported) continue;
+
+                affected[n] = 1;
+                orphans.push_back(n);
+                queue.push_back(n);
+            }
+        }
+
+        for (int orphan : orphans) {
+            distance[orphan] = UNREACHABLE;
+        }
+
+        // 2. Semeia cada órfã com a melhor distância vinda da borda não afetada
+        //    e propaga em ordem de distância (as sementes têm valores diferentes)
+        using Entry = std::pair<int32_t, int>;
+        std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> open;
+        for (int orphan : orphans) {
+            int ox = orphan % width;
+            int oy = orphan / width;
+            if (!occupancy->isWalkable(ox, oy)) continue;
+            int count = neighbors(ox, oy, adj);
+            int32_t best = UNREACHABLE;
+            for (int i = 0; i < count; ++i) {
+                int n = indexOf(adj[i].x, adj[i].y);
+                if (!affected[n] && distance[n] < best) best = distance[n];
+            }
+            if (best != UNREACHABLE) {
+                distance[orphan] = best + 1;
+                open.push({best + 1, orphan});
+            }
+        }
+
+        while (!open.empty()) {
+            auto [d, current] = open.top();
+            open.pop();
+            if (d > distance[current]) continue;
+            int count = neighbors(current % width, current / width, adj);
+            for (int i = 0; i < count; ++i) {
+                if (!occupancy->isWalkable(adj[i].x, adj[i].y)) continue;
+                int n = indexOf(adj[i].x, adj[i].y);
+                if (distance[n] <= d + 1) continue;
+                distance[n] = d + 1;
+                open.push({d + 1, n});
+            }
+        }
+
+        for (int orphan : orphans) {
+            affected[orphan] = 0;
+        }
+    }
+
+    // Próxima célula a partir de `from` (vizinho de menor distância).
+    // Retorna false no destino ou se o destino é inalcançável a partir dali.
+    // Funciona também se o agente foi empurrado para dentro de um obstáculo.
+    bool getNextCell(Cell from, Cell& next) const {
+        if (from.x < 0 || from.x >= width || from.y < 0 || from.y >= height) return false;
+        int32_t best = distance[indexOf(from.x, from.y)];
+        if (best == 0) return false;
+
+        Cell adj[6];
+        int count = neighbors(from.x, from.y, adj);
+        bool found = false;
+        for (int i = 0; i < count; ++i) {
+            int32_t d = distance[indexOf(adj[i].x, adj[i].y)];
+            if (d < best) {
+                best = d;
+                next = adj[i];
+                found = true;
+            }
+        }
+        return found;
+    }
+
+    int32_t getDistance(int x, int y) const {
+        if (x < 0 || x >= width || y < 0 || y >= height) return UNREACHABLE;
+        return distance[indexOf(x, y)];
+    }
+
+    bool isReachable(Cell from) const { return getDistance(from.x, from.y) != UNREACHABLE; }
+    Cell getGoal() const { return goal; }
+    IGridAdapter* getGrid() const { return grid; }
+};
+
+#endif // FLOW_FIELD_H
@@ -0,0 +1,81 @@
+#ifndef FLOW_FIELD_CACHE_H
+#define FLOW_FIELD_CACHE_H
+
+#include "src/Pathfinding/FlowField.h"
+#include "src/Interfaces/IObserver.h"
+#include "src/Observer/GridChangeNotifier.h"
+#include <unordered_map>
+#include <memory>
+
+// Um FlowField por destino distinto, compartilhado pelos agentes que vão para
+// ele. Cada agente que usa o campo incrementa a contagem (acquire) e a
+// decrementa ao chegar/sair (release); o campo é descartado quando ninguém
+// mais o usa. Observa o GridChangeNotifier para reparar os campos vivos;
+// depois de GRID_REPLACED os campos ainda em uso ficam congelados (o grid
+// deles não existe mais) e só saem no release.
+class FlowFieldCache : public IObserver {
+private:
+    struct Entry {
+        std::unique_ptr<FlowField> field;
+        int refCount = 0;
+    };
+
+    IGridAdapter* grid;
+    GridType gridType;
+    int width;
+    std::unordered_map<int, Entry> fields;  // Chave: índice da célula destino
+    int fieldsBuilt = 0;
+
+    int keyOf(Cell goal) const { return goal.y * width + goal.x; }
+
+public:
+    FlowFieldCache(IGridAdapter* g, GridType type) : grid(g), gridType(type), width(g->GetWidth()) {}
+
+    // Obtém (ou constrói) o campo para `goal` e registra mais um usuário
+    FlowField* acquire(Cell goal) {
+        Entry& entry = fields[keyOf(goal)];
+        if (!entry.field) {
+            entry.field = std::make_unique<FlowField>(grid, gridType, goal);
+            fieldsBuilt++;
+        }
+        entry.refCount++;
+        return entry.field.get();
+    }
+
+    void release(FlowField* field) {
+        if (!field) return;
+        auto it = fields.find(keyOf(field->getGoal()));
+        if (it == fields.end() || it->second.field.get() != field) return;
+        if (--it->second.refCount <= 0) {
+            fields.erase(it);
+        }
+    }
+
+    void onNotify(const std::string& event, void* data) override {
+        if (!data) return;
+        if (event == GridEvents::OBSTACLE_CHANGED) {
+            auto* change = static_cast<GridChangeData*>(data);
+            if (change->grid != grid) return;
+            for (auto& [key, entry] : fields) {
+                if (change->isObstacle) {
+                    entry.field->onCellBlocked(change->x, change->y);
+                } else {
+                    entry.field->onCellCleared(change->x, change->y);
+                }
+            }
+        } else if (event == GridEvents::REGION_CHANGED) {
+            // Lote: cada campo vivo é refeito uma vez, não reparado célula a célula
+            if (static_cast<GridRegionData*>(data)->grid != grid) return;
+            for (auto& [key, entry] : fields) {
+                entry.field->build();
+            }
+        } else if (event == GridEvents::GRID_REPLACED) {
+            if (static_cast<GridReplacedData*>(data)->previous == grid) grid = nullptr;
+        }
+    }
+
+    size_t getFieldCount() const { return fields.size(); }
+    int getFieldsBuilt() const { return fieldsBuilt; }
+};
+
+#endif // FLOW_FIELD_CACHE_H
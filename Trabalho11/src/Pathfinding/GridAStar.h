@@ -0,0 +1,113 @@
+#ifndef GRID_ASTAR_H
+#define GRID_ASTAR_H
+
+#include "src/Pathfinding/SearchSpace.h"
+#include "src/Pathfinding/IndexedBinaryHeap.h"
+#include "src/Pathfinding/GridTopology.h"
+#include "src/Core/Cell.h"
+#include <vector>
+#include <algorithm>
+
+// =============================================================================
+// BasicGridAStar — Motor A* parametrizado pela topologia do grid
+// =============================================================================
+// Substitui a busca do Pathfinder legado (lista aberta com varredura linear e
+// std::find em openSet/closedSet). Aqui:
+//   - a lista aberta é um heap binário indexado com decrease-key;
+//   - os nós ficam num vetor contíguo com carimbo de geração, então iniciar
+//     uma consulta não toca as células que a busca nunca alcança;
+//   - aberto/fechado é um flag dentro do próprio nó (teste O(1)).
+// Custo por consulta: O(E log V) sobre os nós efetivamente expandidos.
+//
+// A walkability e a heurística são passadas como funções para que o mesmo
+// motor sirva ao Grid legado e aos adapters. A vizinhança vem do parâmetro
+// Topology (GridTopology::Rect4, Rect8 ou HexOddQ), resolvida em compilação.
+// GridAStar é a instância 4-conectada usada pelo Pathfinder.
+// =============================================================================
+template <typename Topology>
+class BasicGridAStar {
+private:
+    SearchSpace space;
+    IndexedBinaryHeap open;
+    int lastExpandedNodes = 0;
+
+    void reconstruct(int goalIndex, std::vector<Cell>& path) const {
+        path.clear();
+        for (int index = goalIndex; index != -1; index = space[index].parent) {
+            path.push_back({space.xOf(index), space.yOf(index)});
+        }
+        std::reverse(path.begin(), path.end());
+    }
+
+public:
+    // Retorna true e preenche `path` (origem e destino inclusos) se houver caminho
+    template <typename WalkableFn, typename HeuristicFn>
+    bool findPath(int width, int height, Cell start, Cell goal,
+                  WalkableFn&& isWalkable, HeuristicFn&& heuristic,
+                  std::vector<Cell>& path) {
+        path.clear();
+        lastExpandedNodes = 0;
+        if (!isWalkable(start.x, start.y) || !isWalkable(goal.x, goal.y)) {
+            return false;
+        }
+
+        space.resize(width, height);
+        space.beginQuery();
+        open.reset(space);
+
+        int startIndex = space.indexOf(start.x, start.y);
+        int goalIndex = space.indexOf(goal.x, goal.y);
+
+        SearchNode& startNode = space.touch(startIndex);
+        startNode.g = 0.0f;
+        startNode.f = heuristic(start.x, start.y, goal.x, goal.y);
+        startNode.state = NodeState::OPEN;
+        open.push(startIndex);
+
+        while (!open.empty()) {
+            int current = open.pop();
+            SearchNode& currentNode = space[current];
+            currentNode.state = NodeState::CLOSED;
+            lastExpandedNodes++;
+
+            if (current == goalIndex) {
+                reconstruct(goalIndex, path);
+                return true;
+            }
+
+            int cx = space.xOf(current);
+            int cy = space.yOf(current);
+            float newG = currentNode.g + 1.0f;
+
+            const int (*dirs)[2];
+            int dirCount = Topology::directions(cx, dirs);
+            for (int i = 0; i < dirCount; ++i) {
+                int nx = cx + dirs[i][0];
+                int ny = cy + dirs[i][1];
+                if (!isWalkable(nx, ny)) continue;
+
+                int neighborIndex = space.indexOf(nx, ny);
+                SearchNode& neighbor = space.touch(neighborIndex);
+                if (neighbor.state == NodeState::CLOSED || newG >= neighbor.g) continue;
+
+                neighbor.g = newG;
+                neighbor.f = newG + heuristic(nx, ny, goal.x, goal.y);
+                neighbor.parent = current;
+                if (neighbor.state == NodeState::OPEN) {
+                    open.decreaseKey(neighborIndex);
+                } else {
+                    neighbor.state = NodeState::OPEN;
+                    open.push(neighborIndex);
+                }
+            }
+        }
+        return false;
+    }
+
+    // Nós expandidos (fechados) na última consulta — útil para comparar motores
+    int getLastExpandedNodes() const { return lastExpandedNodes; }
+};
+
+typedef BasicGridAStar<GridTopology::Rect4> GridAStar;
+
+#endif // GRID_ASTAR_H
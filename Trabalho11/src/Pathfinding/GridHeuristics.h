@@ -0,0 +1,32 @@
+#ifndef GRID_HEURISTICS_H
+#define GRID_HEURISTICS_H
+
+#include <cstdlib>
+#include <algorithm>
+
+// Heurísticas admissíveis para grids de custo uniforme (1 por passo)
+namespace GridHeuristics {
+
+    // Grid retangular 4-conectado
+    inline float manhattan(int x1, int y1, int x2, int y2) {
+        return static_cast<float>(std::abs(x1 - x2) + std::abs(y1 - y2));
+    }
+
+    // Grid retangular 8-conectado com diagonal de custo 1
+    inline float chebyshev(int x1, int y1, int x2, int y2) {
+        return static_cast<float>(std::max(std::abs(x1 - x2), std::abs(y1 - y2)));
+    }
+
+    // Grid hexagonal offset odd-q: converte para coordenadas cúbicas e usa
+    // a distância hexagonal exata em grid livre (consistente e admissível)
+    inline float hexOddQ(int col1, int row1, int col2, int row2) {
+        int q1 = col1, r1 = row1 - (col1 - (col1 & 1)) / 2;
+        int q2 = col2, r2 = row2 - (col2 - (col2 & 1)) / 2;
+        int dq = q1 - q2;
+        int dr = r1 - r2;
+        return static_cast<float>((std::abs(dq) + std::abs(dr) + std::abs(dq + dr)) / 2);
+    }
+
+}
+
+#endif // GRID_HEURISTICS_H
@@ -0,0 +1,37 @@
+#ifndef GRID_SNAPSHOT_H
+#define GRID_SNAPSHOT_H
+
+#include "src/Interfaces/IGridAdapter.h"
+#include "src/Core/GridType.h"
+#include "src/Core/ObstacleBitGrid.h"
+#include <cstdint>
+
+// Cópia imutável da walkability do grid num dado instante.
+// As threads de busca só leem snapshots, então SetObstacleCommand pode
+// alterar o grid na thread principal sem corrida: a próxima requisição
+// recebe um snapshot novo e as já enfileiradas continuam com o antigo.
+// A cópia é dos bits do ObstacleBitGrid (64 células por palavra).
+class GridSnapshot {
+private:
+    int width;
+    int height;
+    GridType gridType;
+    uint64_t version;
+    ObstacleBitGrid occupancy;
+
+public:
+    GridSnapshot(const IGridAdapter& grid, GridType type, uint64_t ver)
+        : width(grid.GetWidth()), height(grid.GetHeight()), gridType(type), version(ver),
+          occupancy(grid.getOccupancy()) {}
+
+    bool isWalkable(int x, int y) const {
+        return occupancy.isWalkable(x, y);
+    }
+
+    int getWidth() const { return width; }
+    int getHeight() const { return height; }
+    GridType getGridType() const { return gridType; }
+    uint64_t getVersion() const { return version; }
+};
+
+#endif // GRID_SNAPSHOT_H
@@ -0,0 +1,112 @@
+#ifndef GRID_TOPOLOGY_H
+#define GRID_TOPOLOGY_H
+
+#include "src/Pathfinding/GridHeuristics.h"
+#include "src/Core/Cell.h"
+#include "src/Core/GridType.h"
+
+// =============================================================================
+// GridTopology — Vizinhança dos grids resolvida em tempo de compilação
+// =============================================================================
+// IGridAdapter::getNeighbors é virtual e devolve uma std::list nova a cada
+// chamada — caro demais dentro do laço de uma busca. Cada topologia aqui é um
+// tipo com tabelas de direções constexpr e iteração inline:
+//   - Rect4:   4 vizinhos ortogonais, heurística Manhattan;
+//   - Rect8:   8 vizinhos (diagonais com o mesmo custo 1), heurística Chebyshev;
+//   - HexOddQ: 6 vizinhos offset odd-q, tabela escolhida pela paridade da
+//              coluna, heurística de distância hexagonal.
+// Motores instanciados com uma topologia (BasicGridAStar<Topologia>,
+// SlicedAStar::stepWith<Topologia>) não têm despacho virtual nem alocação no
+// laço principal. Código que só conhece o GridType em tempo de execução usa
+// neighbors(type, ...) ou dispatch(type, fn), que escolhem a topologia uma
+// vez por chamada.
+//
+// Todas as funções devolvem apenas vizinhos dentro do mapa; a walkability
+// continua por conta de quem chama.
+// =============================================================================
+namespace GridTopology {
+
+    struct Rect4 {
+        static constexpr int MAX_NEIGHBORS = 4;
+        static constexpr int DIRS[4][2] = {{0, 1}, {1, 0}, {0, -1}, {-1, 0}};
+
+        static int directions(int /*x*/, const int (*&dirs)[2]) {
+            dirs = DIRS;
+            return 4;
+        }
+
+        static float heuristic(int x1, int y1, int x2, int y2) {
+            return GridHeuristics::manhattan(x1, y1, x2, y2);
+        }
+    };
+
+    struct Rect8 {
+        static constexpr int MAX_NEIGHBORS = 8;
+        static constexpr int DIRS[8][2] = {{0, 1}, {1, 0}, {0, -1}, {-1, 0},
+                                           {1, 1}, {1, -1}, {-1, -1}, {-1, 1}};
+
+        static int directions(int /*x*/, const int (*&dirs)[2]) {
+            dirs = DIRS;
+            return 8;
+        }
+
+        static float heuristic(int x1, int y1, int x2, int y2) {
+            return GridHeuristics::chebyshev(x1, y1, x2, y2);
+        }
+    };
+
+    struct HexOddQ {
+        static constexpr int MAX_NEIGHBORS = 6;
+        static constexpr int EVEN_COL_DIRS[6][2] = {{0, -1}, {1, -1}, {1, 0}, {0, 1}, {-1, 0}, {-1, -1}};
+        static constexpr int ODD_COL_DIRS[6][2] = {{0, -1}, {1, 0}, {1, 1}, {0, 1}, {-1, 1}, {-1, 0}};
+
+        static int directions(int x, const int (*&dirs)[2]) {
+            dirs = (x % 2 == 0) ? EVEN_COL_DIRS : ODD_COL_DIRS;
+            return 6;
+        }
+
+        static float heuristic(int x1, int y1, int x2, int y2) {
+            return GridHeuristics::hexOddQ(x1, y1, x2, y2);
+        }
+    };
+
+    // Chama fn(nx, ny) para cada vizinho dentro do mapa
+    template <typename Topology, typename Fn>
+    inline void forEachNeighbor(int x, int y, int width, int height, Fn&& fn) {
+        const int (*dirs)[2];
+        int count = Topology::directions(x, dirs);
+        for (int i = 0; i < count; ++i) {
+            int nx = x + dirs[i][0];
+            int ny = y + dirs[i][1];
+            if (nx >= 0 && nx < width && ny >= 0 && ny < height) fn(nx, ny);
+        }
+    }
+
+    // Preenche `out` com os vizinhos dentro do mapa; retorna quantos
+    template <typename Topology>
+    inline int neighbors(int x, int y, int width, int height, Cell* out) {
+        int count = 0;
+        forEachNeighbor<Topology>(x, y, width, height, [&](int nx, int ny) {
+            out[count++] = {nx, ny};
+        });
+        return count;
+    }
+
+    // Versão com a topologia escolhida pelo GridType (out com espaço para 6)
+    inline int neighbors(GridType type, int x, int y, int width, int height, Cell* out) {
+        return type == GridType::HEXAGONAL ?
+            neighbors<HexOddQ>(x, y, width, height, out) :
+            neighbors<Rect4>(x, y, width, height, out);
+    }
+
+    // Executa fn(Topologia{}) com a topologia do GridType — o corpo de fn é
+    // instanciado uma vez por topologia
+    template <typename Fn>
+    inline auto dispatch(GridType type, Fn&& fn) -> decltype(fn(Rect4{})) {
+        if (type == GridType::HEXAGONAL) return fn(HexOddQ{});
+        return fn(Rect4{});
+    }
+
+}
+
+#endif // GRID_TOPOLOGY_H
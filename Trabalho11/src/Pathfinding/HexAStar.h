@@ -0,0 +1,140 @@
+#ifndef HEX_ASTAR_H
+#define HEX_ASTAR_H
+
+#include "src/Pathfinding/SearchSpace.h"
+#include "src/Pathfinding/GridTopology.h"
+#include "src/Core/Cell.h"
+#include <vector>
+#include <algorithm>
+#include <functional>
+#include <utility>
+
+// =============================================================================
+// HexAStar — Motor A* para grid hexagonal odd-q
+// =============================================================================
+// Substitui a busca do HexagonalGridAdapter::FindPathHex, que mantinha três
+// std::unordered_map<Cell,…> (nós, fechados, abertos), um comparador que
+// consultava o mapa a cada operação do heap e uma std::list de vizinhos
+// alocada por expansão. Aqui:
+//   - os nós ficam num SearchSpace coluna×linha com carimbo de geração;
+//   - o heap guarda pares (f, índice) por valor, sem consultar os nós ao
+//     comparar. Em vez de decrease-key, uma melhora empurra uma entrada
+//     nova; entradas obsoletas (nó já fechado ou f diferente) são
+//     descartadas ao sair do topo;
+//   - os vizinhos vêm das tabelas de GridTopology::HexOddQ, sem alocação.
+//
+// Heurística: distância hexagonal em coordenadas cúbicas (GridHeuristics::
+// hexOddQ), admissível e consistente — os caminhos saem ótimos. Pode ser
+// trocada pela de landmarks (LandmarkTable) na sobrecarga com heurística.
+// =============================================================================
+class HexAStar {
+private:
+    typedef std::pair<float, int> OpenEntry;  // (f, índice)
+
+    SearchSpace space;
+    std::vector<OpenEntry> open;
+    int lastExpandedNodes = 0;
+
+    void reconstruct(int goalIndex, std::vector<Cell>& path) const {
+        path.clear();
+        for (int index = goalIndex; index != -1; index = space[index].parent) {
+            path.push_back({space.xOf(index), space.yOf(index)});
+        }
+        std::reverse(path.begin(), path.end());
+    }
+
+    void pushOpen(float f, int index) {
+        open.push_back({f, index});
+        std::push_heap(open.begin(), open.end(), std::greater<OpenEntry>());
+    }
+
+    OpenEntry popOpen() {
+        std::pop_heap(open.begin(), open.end(), std::greater<OpenEntry>());
+        OpenEntry top = open.back();
+        open.pop_back();
+        return top;
+    }
+
+public:
+    // Retorna true e preenche `path` (origem e destino inclusos) se houver caminho
+    template <typename WalkableFn>
+    bool findPath(int width, int height, Cell start, Cell goal,
+                  WalkableFn&& isWalkable, std::vector<Cell>& path) {
+        return findPath(width, height, start, goal, isWalkable,
+                        GridTopology::HexOddQ::heuristic, path);
+    }
+
+    // Mesma busca com heurística própria (ex.: LandmarkTable); precisa ser
+    // admissível e consistente para o caminho sair ótimo
+    template <typename WalkableFn, typename HeuristicFn>
+    bool findPath(int width, int height, Cell start, Cell goal,
+                  WalkableFn&& isWalkable, HeuristicFn&& heuristic,
+                  std::vector<Cell>& path) {
+        typedef GridTopology::HexOddQ Hex;
+
+        path.clear();
+        lastExpandedNodes = 0;
+        auto inside = [width, height](int x, int y) {
+            return x >= 0 && x < width && y >= 0 && y < height;
+        };
+        if (!inside(start.x, start.y) || !inside(goal.x, goal.y) ||
+            !isWalkable(start.x, start.y) || !isWalkable(goal.x, goal.y)) {
+            return false;
+        }
+
+        space.resize(width, height);
+        space.beginQuery();
+        open.clear();
+
+        int startIndex = space.indexOf(start.x, start.y);
+        int goalIndex = space.indexOf(goal.x, goal.y);
+
+        SearchNode& startNode = space.touch(startIndex);
+        startNode.g = 0.0f;
+        startNode.f = heuristic(start.x, start.y, goal.x, goal.y);
+        startNode.state = NodeState::OPEN;
+        pushOpen(startNode.f, startIndex);
+
+        while (!open.empty()) {
+            OpenEntry top = popOpen();
+            int current = top.second;
+            SearchNode& currentNode = space[current];
+            if (currentNode.state == NodeState::CLOSED || top.first != currentNode.f) continue;
+            currentNode.state = NodeState::CLOSED;
+            lastExpandedNodes++;
+
+            if (current == goalIndex) {
+                reconstruct(goalIndex, path);
+                return true;
+            }
+
+            int cx = space.xOf(current);
+            int cy = space.yOf(current);
+            float newG = currentNode.g + 1.0f;
+            const int (*dirs)[2];
+            int dirCount = Hex::directions(cx, dirs);
+
+            for (int i = 0; i < dirCount; ++i) {
+                int nx = cx + dirs[i][0];
+                int ny = cy + dirs[i][1];
+                if (!inside(nx, ny) || !isWalkable(nx, ny)) continue;
+
+                int neighborIndex = space.indexOf(nx, ny);
+                SearchNode& neighbor = space.touch(neighborIndex);
+                if (neighbor.state == NodeState::CLOSED || newG >= neighbor.g) continue;
+
+                neighbor.g = newG;
+                neighbor.f = newG + heuristic(nx, ny, goal.x, goal.y);
+                neighbor.parent = current;
+                neighbor.state = NodeState::OPEN;
+                pushOpen(neighbor.f, neighborIndex);
+            }
+        }
+        return false;
+    }
+
+    // Nós expandidos (fechados) na última consulta — útil para comparar motores
+    int getLastExpandedNodes() const { return lastExpandedNodes; }
+};
+
+#endif // HEX_ASTAR_H
@@ -0,0 +1,540 @@
+#ifndef HIERARCHICAL_PATHFINDER_H
+#define HIERARCHICAL_PATHFINDER_H
+
+#include "src/Interfaces/IGridAdapter.h"
+#include "src/Interfaces/IObserver.h"
+#include "src/Observer/GridChangeNotifier.h"
+#include "src/Pathfinding/GridTopology.h"
+#include "src/Pathfinding/LandmarkTable.h"
+#include "src/Core/Cell.h"
+#include "src/Core/GridType.h"
+#include <vector>
+#include <unordered_map>
+#include <map>
+#include <queue>
+#include <algorithm>
+#include <functional>
+#include <limits>
+
+// =============================================================================
+// HierarchicalPathfinder — HPA* (Hierarchical Path-Finding A*)
+// =============================================================================
+// Divide o grid em clusters de C×C células e pré-calcula um grafo abstrato:
+//   - Entradas: trechos contíguos livres na fronteira entre dois clusters.
+//     Cada trecho gera uma transição (ou duas, nas pontas, se for longo);
+//     as células das transições são os nós abstratos.
+//   - Arestas inter-cluster: ligam as duas células de uma transição (custo 1).
+//   - Arestas intra-cluster: distância BFS entre nós do mesmo cluster,
+//     calculada só dentro do cluster.
+//
+// Uma consulta liga origem e destino aos nós do seu cluster, roda A* no grafo
+// abstrato e refina cada trecho com buscas locais (limitadas ao cluster).
+// Com uma LandmarkTable, o A* abstrato usa a heurística ALT: as arestas
+// abstratas valem pelo menos a distância real, então ela segue admissível.
+// O custo cresce com o número de clusters atravessados, não com o tamanho
+// do mapa.
+//
+// Quando uma célula muda (GridEvents::OBSTACLE_CHANGED), só são refeitas as
+// fronteiras que tocam a célula e as arestas intra dos clusters envolvidos;
+// numa edição em lote (GridEvents::REGION_CHANGED), os clusters da região.
+//
+// A vizinhança vem de GridTopology conforme o GridType, então funciona tanto
+// no grid retangular quanto no hexagonal.
+// =============================================================================
+class HierarchicalPathfinder : public IObserver {
+private:
+    struct AbstractEdge {
+        int to;       // Índice da célula do nó de destino
+        float cost;
+    };
+
+    struct AbstractNode {
+        int cluster;
+        int refCount = 0;                 // Quantas transições usam esta célula
+        std::vector<AbstractEdge> intra;  // Arestas dentro do cluster
+        std::vector<int> inter;           // Células vizinhas em outros clusters
+    };
+
+    using Transition = std::pair<int, int>;  // (célula no cluster a, célula no cluster b)
+
+    IGridAdapter* grid;
+    const ObstacleBitGrid* occupancy;  // Bits de obstáculo do grid (sem chamada virtual)
+    GridType gridType;
+    int clusterSize;
+    int width = 0;
+    int height = 0;
+    int clustersX = 0;
+    int clustersY = 0;
+
+    std::unordered_map<int, AbstractNode> nodes;        // chave = índice da célula
+    std::vector<std::vector<int>> clusterNodes;         // nós abstratos de cada cluster
+    std::vector<std::vector<int>> clusterNeighbors;     // clusters adjacentes (topologia)
+    std::map<std::pair<int, int>, std::vector<Transition>> borders;  // (a < b) -> transições
+
+    // Buffers da BFS local (tamanho C×C, reaproveitados)
+    std::vector<int> localDist;
+    std::vector<int> localParent;
+    std::vector<int> localQueue;
+
+    int lastExpandedNodes = 0;
+
+    // Trechos de fronteira com este comprimento ou mais ganham duas transições
+    static const int LONG_ENTRANCE = 6;
+
+    int cellIndex(int x, int y) const { return y * width + x; }
+    Cell cellOf(int index) const { return {index % width, index / width}; }
+
+    int clusterOf(int x, int y) const {
+        return (y / clusterSize) * clustersX + (x / clusterSize);
+    }
+
+    void clusterBounds(int cluster, int& x0, int& y0, int& x1, int& y1) const {
+        x0 = (cluster % clustersX) * clusterSize;
+        y0 = (cluster / clustersX) * clusterSize;
+        x1 = std::min(x0 + clusterSize, width) - 1;
+        y1 = std::min(y0 + clusterSize, height) - 1;
+    }
+
+    bool isOnClusterRing(int x, int y) const {
+        int x0, y0, x1, y1;
+        clusterBounds(clusterOf(x, y), x0, y0, x1, y1);
+        return x == x0 || x == x1 || y == y0 || y == y1;
+    }
+
+    int neighbors(int x, int y, Cell out[6]) const {
+        return GridTopology::neighbors(gridType, x, y, width, height, out);
+    }
+
+    float heuristic(int x1, int y1, int x2, int y2) const {
+        if (gridType == GridType::HEXAGONAL) {
+            return GridHeuristics::hexOddQ(x1, y1, x2, y2);
+        }
+        return GridHeuristics::manhattan(x1, y1, x2, y2);
+    }
+
+    // Aplica fn(x, y) a cada célula da borda do cluster
+    template <typename Fn>
+    void forEachRingCell(int cluster, Fn&& fn) const {
+        int x0, y0, x1, y1;
+        clusterBounds(cluster, x0, y0, x1, y1);
+        for (int y = y0; y <= y1; ++y) {
+            for (int x = x0; x <= x1; ++x) {
+                if (x == x0 || x == x1 || y == y0 || y == y1) {
+                    fn(x, y);
+                }
+            }
+        }
+    }
+
+    // BFS restrita a um cluster. Preenche localDist/localParent (índices locais).
+    // Para cedo se `stopAt` (índice global) for alcançado.
+    void localBFS(int cluster, int source, int stopAt = -1) {
+        int x0, y0, x1, y1;
+        clusterBounds(cluster, x0, y0, x1, y1);
+        int localW = x1 - x0 + 1;
+        int localSize = localW * (y1 - y0 + 1);
+        localDist.assign(localSize, -1);
+        localParent.assign(localSize, -1);
+        localQueue.clear();
+
+        Cell s = cellOf(source);
+        int sl = (s.y - y0) * localW + (s.x - x0);
+        localDist[sl] = 0;
+        localQueue.push_back(sl);
+
+        for (size_t head = 0; head < localQueue.size(); ++head) {
+            int current = localQueue[head];
+            int cx = x0 + current % localW;
+            int cy = y0 + current / localW;
+            lastExpandedNodes++;
+            if (cellIndex(cx, cy) == stopAt) return;
+
+            Cell adj[6];
+            int adjCount = neighbors(cx, cy, adj);
+            for (int i = 0; i < adjCount; ++i) {
+                const Cell& n = adj[i];
+                if (n.x < x0 || n.x > x1 || n.y < y0 || n.y > y1) continue;
+                if (!occupancy->isWalkable(n.x, n.y)) continue;
+                int nl = (n.y - y0) * localW + (n.x - x0);
+                if (localDist[nl] != -1) continue;
+                localDist[nl] = localDist[current] + 1;
+                localParent[nl] = current;
+                localQueue.push_back(nl);
+            }
+        }
+    }
+
+    int localDistanceTo(int cluster, int target) const {
+        int x0, y0, x1, y1;
+        clusterBounds(cluster, x0, y0, x1, y1);
+        Cell t = cellOf(target);
+        return localDist[(t.y - y0) * (x1 - x0 + 1) + (t.x - x0)];
+    }
+
+    // Caminho local de `from` até `to` dentro do cluster (sem a célula inicial)
+    bool appendLocalPath(int cluster, int from, int to, std::vector<Cell>& out) {
+        if (from == to) return true;
+        localBFS(cluster, from, to);
+        int x0, y0, x1, y1;
+        clusterBounds(cluster, x0, y0, x1, y1);
+        int localW = x1 - x0 + 1;
+        Cell t = cellOf(to);
+        int tl = (t.y - y0) * localW + (t.x - x0);
+        if (localDist[tl] == -1) return false;
+
+        size_t insertAt = out.size();
+        for (int l = tl; localParent[l] != -1; l = localParent[l]) {
+            out.push_back({x0 + l % localW, y0 + l / localW});
+        }
+        std::reverse(out.begin() + insertAt, out.end());
+        return true;
+    }
+
+    // --- Manutenção do grafo abstrato ---
+
+    void addNodeRef(int cell, int cluster) {
+        auto it = nodes.find(cell);
+        if (it == nodes.end()) {
+            AbstractNode node;
+            node.cluster = cluster;
+            it = nodes.emplace(cell, std::move(node)).first;
+            clusterNodes[cluster].push_back(cell);
+        }
+        it->second.refCount++;
+    }
+
+    void releaseNodeRef(int cell) {
+        auto it = nodes.find(cell);
+        if (it == nodes.end()) return;
+        if (--it->second.refCount > 0) return;
+        auto& list = clusterNodes[it->second.cluster];
+        list.erase(std::remove(list.begin(), list.end(), cell), list.end());
+        nodes.erase(it);
+    }
+
+    static void eraseOne(std::vector<int>& list, int value) {
+        auto it = std::find(list.begin(), list.end(), value);
+        if (it != list.end()) list.erase(it);
+    }
+
+    void clearBorder(int a, int b) {
+        auto it = borders.find({a, b});
+        if (it == borders.end()) return;
+        for (const auto& t : it->second) {
+            eraseOne(nodes[t.first].inter, t.second);
+            eraseOne(nodes[t.second].inter, t.first);
+            releaseNodeRef(t.first);
+            releaseNodeRef(t.second);
+        }
+        borders.erase(it);
+    }
+
+    // Detecta os trechos livres entre os clusters a e b e cria as transições
+    void buildBorder(int a, int b) {
+        std::vector<Transition> edges;
+        forEachRingCell(a, [&](int x, int y) {
+            if (!occupancy->isWalkable(x, y)) return;
+            Cell adj[6];
+            int adjCount = neighbors(x, y, adj);
+            for (int i = 0; i < adjCount; ++i) {
+                const Cell& n = adj[i];
+                if (clusterOf(n.x, n.y) == b && occupancy->isWalkable(n.x, n.y)) {
+                    edges.push_back({cellIndex(x, y), cellIndex(n.x, n.y)});
+                }
+            }
+        });
+        if (edges.empty()) return;
+
+        std::sort(edges.begin(), edges.end());
+        auto adjacent = [this](int c1, int c2) {
+            Cell p = cellOf(c1), q = cellOf(c2);
+            return std::abs(p.x - q.x) <= 1 && std::abs(p.y - q.y) <= 1;
+        };
+
+        std::vector<Transition>& transitions = borders[{a, b}];
+        auto addTransition = [&](const Transition& t) {
+            for (const auto& existing : transitions) {
+                if (existing == t) return;
+            }
+            transitions.push_back(t);
+            addNodeRef(t.first, a);
+            addNodeRef(t.second, b);
+            nodes[t.first].inter.push_back(t.second);
+            nodes[t.second].inter.push_back(t.first);
+        };
+
+        // Agrupa arestas consecutivas em trechos contíguos da fronteira
+        size_t runStart = 0;
+        for (size_t i = 1; i <= edges.size(); ++i) {
+            bool endOfRun = (i == edges.size()) ||
+                !adjacent(edges[i].first, edges[i - 1].first) ||
+                !adjacent(edges[i].second, edges[i - 1].second);
+            if (!endOfRun) continue;
+
+            size_t runLength = i - runStart;
+            if (runLength >= LONG_ENTRANCE) {
+                addTransition(edges[runStart]);
+                addTransition(edges[i - 1]);
+            } else {
+                addTransition(edges[runStart + runLength / 2]);
+            }
+            runStart = i;
+        }
+    }
+
+    void rebuildBorder(int a, int b) {
+        if (a > b) std::swap(a, b);
+        clearBorder(a, b);
+        buildBorder(a, b);
+    }
+
+    // Recalcula as arestas intra-cluster (BFS de cada nó abstrato do cluster)
+    void rebuildIntraEdges(int cluster) {
+        const auto& members = clusterNodes[cluster];
+        for (int u : members) {
+            auto& node = nodes[u];
+            node.intra.clear();
+            localBFS(cluster, u);
+            for (int v : members) {
+                if (v == u) continue;
+                int d = localDistanceTo(cluster, v);
+                if (d >= 0) node.intra.push_back({v, static_cast<float>(d)});
+            }
+        }
+    }
+
+    void computeClusterNeighbors() {
+        clusterNeighbors.assign(clustersX * clustersY, {});
+        for (int k = 0; k < clustersX * clustersY; ++k) {
+            auto& list = clusterNeighbors[k];
+            forEachRingCell(k, [&](int x, int y) {
+                Cell adj[6];
+                int adjCount = neighbors(x, y, adj);
+                for (int i = 0; i < adjCount; ++i) {
+                    const Cell& n = adj[i];
+                    int other = clusterOf(n.x, n.y);
+                    if (other != k && std::find(list.begin(), list.end(), other) == list.end()) {
+                        list.push_back(other);
+                    }
+                }
+            });
+        }
+    }
+
+public:
+    HierarchicalPathfinder(IGridAdapter* adapter, GridType type, int clusterSz = 16)
+        : grid(adapter), occupancy(&adapter->getOccupancy()), gridType(type), clusterSize(std::max(2, clusterSz)) {
+        build();
+    }
+
+    // Constrói toda a hierarquia (usado na criação ou quando o grid é trocado)
+    void build() {
+        nodes.clear();
+        borders.clear();
+        width = grid->GetWidth();
+        height = grid->GetHeight();
+        clustersX = (width + clusterSize - 1) / clusterSize;
+        clustersY = (height + clusterSize - 1) / clusterSize;
+        clusterNodes.assign(clustersX * clustersY, {});
+
+        computeClusterNeighbors();
+        for (int k = 0; k < clustersX * clustersY; ++k) {
+            for (int n : clusterNeighbors[k]) {
+                if (n > k) buildBorder(k, n);
+            }
+        }
+        for (int k = 0; k < clustersX * clustersY; ++k) {
+            rebuildIntraEdges(k);
+        }
+    }
+
+    // Reparo incremental após a mudança de uma célula
+    void onCellChanged(int x, int y) {
+        if (!grid->isValidCoordinate(x, y)) return;
+        int cluster = clusterOf(x, y);
+        std::vector<int> touched = {cluster};
+
+        if (isOnClusterRing(x, y)) {
+            // Só as fronteiras que a célula toca podem mudar de entradas
+            Cell adj[6];
+            int adjCount = neighbors(x, y, adj);
+            for (int i = 0; i < adjCount; ++i) {
+                const Cell& n = adj[i];
+                int other = clusterOf(n.x, n.y);
+                if (other != cluster && std::find(touched.begin(), touched.end(), other) == touched.end()) {
+                    touched.push_back(other);
+                    rebuildBorder(cluster, other);
+                }
+            }
+        }
+        for (int k : touched) {
+            rebuildIntraEdges(k);
+        }
+    }
+
+    // Reparo após uma edição em lote: cada cluster que a região toca refaz
+    // todas as suas fronteiras (uma vez por par) e as arestas intra dos
+    // clusters envolvidos — o resto da hierarquia não muda
+    void onRegionChanged(const GridRect& area) {
+        int x0 = std::max(area.x0, 0);
+        int y0 = std::max(area.y0, 0);
+        int x1 = std::min(area.x1, width - 1);
+        int y1 = std::min(area.y1, height - 1);
+        if (x0 > x1 || y0 > y1) return;
+
+        std::vector<char> touched(clustersX * clustersY, 0);
+        for (int cy = y0 / clusterSize; cy <= y1 / clusterSize; ++cy) {
+            for (int cx = x0 / clusterSize; cx <= x1 / clusterSize; ++cx) {
+                touched[cy * clustersX + cx] = 1;
+            }
+        }
+        std::vector<char> dirty = touched;
+        for (int k = 0; k < clustersX * clustersY; ++k) {
+            if (!touched[k]) continue;
+            for (int n : clusterNeighbors[k]) {
+                if (touched[n] && n < k) continue;  // Par já refeito a partir de n
+                rebuildBorder(k, n);
+                dirty[n] = 1;
+            }
+        }
+        for (int k = 0; k < clustersX * clustersY; ++k) {
+            if (dirty[k]) rebuildIntraEdges(k);
+        }
+    }
+
+    // O grid foi trocado (GRID_REPLACED): o grafo abstrato era dele e é
+    // descartado; findPath passa a falhar
+    void forgetGrid() {
+        grid = nullptr;
+        occupancy = nullptr;
+        nodes.clear();
+        borders.clear();
+        for (auto& cluster : clusterNodes) cluster.clear();
+    }
+
+    // IObserver: reage às alterações publicadas pelo GridChangeNotifier
+    void onNotify(const std::string& event, void* data) override {
+        if (!data) return;
+        if (event == GridEvents::OBSTACLE_CHANGED) {
+            auto* change = static_cast<GridChangeData*>(data);
+            if (change->grid == grid) onCellChanged(change->x, change->y);
+        } else if (event == GridEvents::REGION_CHANGED) {
+            auto* region = static_cast<GridRegionData*>(data);
+            if (region->grid == grid) onRegionChanged(region->area);
+        } else if (event == GridEvents::GRID_REPLACED) {
+            if (static_cast<GridReplacedData*>(data)->previous == grid) forgetGrid();
+        }
+    }
+
+    // Busca hierárquica. Retorna true e preenche `path` (uma célula por passo)
+    bool findPath(Cell start, Cell goal, std::vector<Cell>& path, const LandmarkTable* landmarks = nullptr) {
+        path.clear();
+        lastExpandedNodes = 0;
+        if (!occupancy || !occupancy->isWalkable(start.x, start.y) || !occupancy->isWalkable(goal.x, goal.y)) {
+            return false;
+        }
+        path.push_back(start);
+        if (start == goal) return true;
+
+        int s = cellIndex(start.x, start.y);
+        int g = cellIndex(goal.x, goal.y);
+        int ks = clusterOf(start.x, start.y);
+        int kg = clusterOf(goal.x, goal.y);
+
+        // Mesmo cluster: tenta primeiro a busca local
+        if (ks == kg && appendLocalPath(ks, s, g, path)) {
+            return true;
+        }
+
+        // Liga origem e destino aos nós abstratos dos seus clusters
+        const int START = -1;
+        const int GOAL = -2;
+        std::unordered_map<int, float> startEdges, goalEdges;
+        localBFS(ks, s);
+        for (int v : clusterNodes[ks]) {
+            int d = localDistanceTo(ks, v);
+            if (d >= 0) startEdges[v] = static_cast<float>(d);
+        }
+        localBFS(kg, g);
+        for (int v : clusterNodes[kg]) {
+            int d = localDistanceTo(kg, v);
+            if (d >= 0) goalEdges[v] = static_cast<float>(d);
+        }
+        if (startEdges.empty() || goalEdges.empty()) {
+            path.clear();
+            return false;
+        }
+
+        // A* no grafo abstrato
+        using Entry = std::pair<float, int>;
+        std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> open;
+        std::unordered_map<int, float> gScore;
+        std::unordered_map<int, int> parent;
+        auto h = [&](int key) {
+            if (key == GOAL) return 0.0f;
+            Cell c = (key == START) ? start : cellOf(key);
+            return landmarks ? landmarks->estimate(c.x, c.y, goal.x, goal.y) : heuristic(c.x, c.y, goal.x, goal.y);
+        };
+        auto relax = [&](int from, int to, float cost) {
+            float tentative = gScore[from] + cost;
+            auto it = gScore.find(to);
+            if (it != gScore.end() && tentative >= it->second) return;
+            gScore[to] = tentative;
+            parent[to] = from;
+            open.push({tentative + h(to), to});
+        };
+
+        gScore[START] = 0.0f;
+        open.push({h(START), START});
+        bool found = false;
+        while (!open.empty()) {
+            auto [f, current] = open.top();
+            open.pop();
+            if (f > gScore[current] + h(current) + 1e-4f) continue;  // entrada obsoleta
+            lastExpandedNodes++;
+            if (current == GOAL) { found = true; break; }
+
+            if (current == START) {
+                for (const auto& [v, d] : startEdges) relax(START, v, d);
+                continue;
+            }
+            const AbstractNode& node = nodes[current];
+            for (const auto& e : node.intra) relax(current, e.to, e.cost);
+            for (int n : node.inter) relax(current, n, 1.0f);
+            auto goalIt = goalEdges.find(current);
+            if (goalIt != goalEdges.end()) relax(current, GOAL, goalIt->second);
+        }
+        if (!found) {
+            path.clear();
+            return false;
+        }
+
+        // Sequência abstrata: START, n1, ..., nk, GOAL
+        std::vector<int> abstractPath;
+        for (int key = GOAL; key != START; key = parent[key]) abstractPath.push_back(key);
+        std::reverse(abstractPath.begin(), abstractPath.end());
+
+        // Refinamento: trechos intra viram buscas locais, inter são um passo
+        int previous = s;
+        for (int key : abstractPath) {
+            int cell = (key == GOAL) ? g : key;
+            Cell pc = cellOf(previous), cc = cellOf(cell);
+            int kp = clusterOf(pc.x, pc.y);
+            if (kp != clusterOf(cc.x, cc.y)) {
+                path.push_back(cc);
+            } else if (!appendLocalPath(kp, previous, cell, path)) {
+                path.clear();
+                return false;
+            }
+            previous = cell;
+        }
+        return true;
+    }
+
+    int getLastExpandedNodes() const { return lastExpandedNodes; }
+    int getAbstractNodeCount() const { return static_cast<int>(nodes.size()); }
+    int getClusterSize() const { return clusterSize; }
+    IGridAdapter* getGrid() const { return grid; }
+};
+
+#endif // HIERARCHICAL_PATHFINDER_H
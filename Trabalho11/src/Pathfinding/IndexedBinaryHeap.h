@@ -0,0 +1,85 @@
+#ifndef INDEXED_BINARY_HEAP_H
+#define INDEXED_BINARY_HEAP_H
+
+#include "src/Pathfinding/SearchSpace.h"
+#include <vector>
+
+// Min-heap binário de índices de nós com suporte a decrease-key.
+// A posição de cada nó no heap fica em SearchNode::heapIndex, então
+// atualizar a prioridade de um nó já aberto custa O(log n) sem busca linear.
+// Ordena por menor f; em empate, prefere maior g (menor heurística restante).
+class IndexedBinaryHeap {
+private:
+    std::vector<int> heap;
+    SearchSpace* space = nullptr;
+
+    bool less(int a, int b) const {
+        const SearchNode& na = (*space)[a];
+        const SearchNode& nb = (*space)[b];
+        if (na.f != nb.f) return na.f < nb.f;
+        return na.g > nb.g;
+    }
+
+    void place(int pos, int index) {
+        heap[pos] = index;
+        (*space)[index].heapIndex = pos;
+    }
+
+    void siftUp(int pos) {
+        int index = heap[pos];
+        while (pos > 0) {
+            int parent = (pos - 1) / 2;
+            if (!less(index, heap[parent])) break;
+            place(pos, heap[parent]);
+            pos = parent;
+        }
+        place(pos, index);
+    }
+
+    void siftDown(int pos) {
+        int index = heap[pos];
+        int size = static_cast<int>(heap.size());
+        while (true) {
+            int child = 2 * pos + 1;
+            if (child >= size) break;
+            if (child + 1 < size && less(heap[child + 1], heap[child])) child++;
+            if (!less(heap[child], index)) break;
+            place(pos, heap[child]);
+            pos = child;
+        }
+        place(pos, index);
+    }
+
+public:
+    void reset(SearchSpace& s) {
+        space = &s;
+        heap.clear();
+    }
+
+    bool empty() const { return heap.empty(); }
+    size_t size() const { return heap.size(); }
+
+    void push(int index) {
+        heap.push_back(index);
+        siftUp(static_cast<int>(heap.size()) - 1);
+    }
+
+    // Chamado depois de diminuir o f de um nó que já está no heap
+    void decreaseKey(int index) {
+        siftUp((*space)[index].heapIndex);
+    }
+
+    int pop() {
+        int top = heap.front();
+        (*space)[top].heapIndex = -1;
+        int last = heap.back();
+        heap.pop_back();
+        if (!heap.empty()) {
+            heap[0] = last;
+            siftDown(0);
+        }
+        return top;
+    }
+};
+
+#endif // INDEXED_BINARY_HEAP_H
@@ -0,0 +1,202 @@
+#ifndef JUMP_POINT_SEARCH_H
+#define JUMP_POINT_SEARCH_H
+
+#include "src/Pathfinding/SearchSpace.h"
+#include "src/Pathfinding/IndexedBinaryHeap.h"
+#include "src/Pathfinding/GridTopology.h"
+#include "src/Core/Cell.h"
+#include <vector>
+#include <algorithm>
+#include <cstdlib>
+
+// =============================================================================
+// JumpPointSearch — JPS para grid retangular 4-conectado de custo uniforme
+// =============================================================================
+// Em mapas abertos o A* expande quase todas as células entre origem e destino,
+// porque existem muitos caminhos ótimos simétricos. O JPS poda essa simetria:
+// a partir de um nó, "salta" em linha reta até encontrar um ponto de salto
+// (destino, vizinho forçado por obstáculo ou, no movimento vertical, uma
+// linha horizontal que leva a um ponto de salto). Só esses pontos entram na
+// lista aberta.
+//
+// Regras (variante 4-conectada):
+//   - Horizontal: para em (x,y) se uma célula vertical vizinha está livre e
+//     a célula correspondente atrás dela está bloqueada (vizinho forçado).
+//   - Vertical: idem para vizinhos horizontais, e também para se um salto
+//     horizontal a partir de (x,y) encontra um ponto de salto.
+//
+// O resultado é expandido de volta para uma célula por waypoint, no mesmo
+// formato produzido pelo GridAStar (origem e destino inclusos).
+// =============================================================================
+class JumpPointSearch {
+private:
+    SearchSpace space;
+    IndexedBinaryHeap open;
+    int lastExpandedNodes = 0;
+    int goalX = 0;
+    int goalY = 0;
+
+    template <typename WalkableFn>
+    bool jumpHorizontal(int x, int y, int dx, WalkableFn& isWalkable, int& outX) const {
+        while (isWalkable(x, y)) {
+            if ((x == goalX && y == goalY) ||
+                (isWalkable(x, y - 1) && !isWalkable(x - dx, y - 1)) ||
+                (isWalkable(x, y + 1) && !isWalkable(x - dx, y + 1))) {
+                outX = x;
+                return true;
+            }
+            x += dx;
+        }
+        return false;
+    }
+
+    template <typename WalkableFn>
+    bool jumpVertical(int x, int y, int dy, WalkableFn& isWalkable, int& outY) const {
+        int ignored;
+        while (isWalkable(x, y)) {
+            if ((x == goalX && y == goalY) ||
+                (isWalkable(x - 1, y) && !isWalkable(x - 1, y - dy)) ||
+                (isWalkable(x + 1, y) && !isWalkable(x + 1, y - dy)) ||
+                jumpHorizontal(x + 1, y, 1, isWalkable, ignored) ||
+                jumpHorizontal(x - 1, y, -1, isWalkable, ignored)) {
+                outY = y;
+                return true;
+            }
+            y += dy;
+        }
+        return false;
+    }
+
+    // Salta de (x,y) na direção (dx,dy); retorna o índice do ponto de salto ou -1
+    template <typename WalkableFn>
+    int jump(int x, int y, int dx, int dy, WalkableFn& isWalkable) const {
+        if (dx != 0) {
+            int jx;
+            return jumpHorizontal(x + dx, y, dx, isWalkable, jx) ? space.indexOf(jx, y) : -1;
+        }
+        int jy;
+        return jumpVertical(x, y + dy, dy, isWalkable, jy) ? space.indexOf(x, jy) : -1;
+    }
+
+    void reconstruct(int goalIndex, std::vector<Cell>& path) const {
+        path.clear();
+        int index = goalIndex;
+        while (index != -1) {
+            int parent = space[index].parent;
+            int x = space.xOf(index);
+            int y = space.yOf(index);
+            path.push_back({x, y});
+            if (parent != -1) {
+                // Preenche as células intermediárias do segmento reto
+                int px = space.xOf(parent);
+                int py = space.yOf(parent);
+                int sx = (px > x) - (px < x);
+                int sy = (py > y) - (py < y);
+                for (x += sx, y += sy; x != px || y != py; x += sx, y += sy) {
+                    path.push_back({x, y});
+                }
+            }
+            index = parent;
+        }
+        std::reverse(path.begin(), path.end());
+    }
+
+public:
+    template <typename WalkableFn, typename HeuristicFn>
+    bool findPath(int width, int height, Cell start, Cell goal,
+                  WalkableFn&& isWalkable, HeuristicFn&& heuristic,
+                  std::vector<Cell>& path) {
+
+        path.clear();
+        lastExpandedNodes = 0;
+        if (!isWalkable(start.x, start.y) || !isWalkable(goal.x, goal.y)) {
+            return false;
+        }
+
+        space.resize(width, height);
+        space.beginQuery();
+        open.reset(space);
+        goalX = goal.x;
+        goalY = goal.y;
+
+        int startIndex = space.indexOf(start.x, start.y);
+        int goalIndex = space.indexOf(goal.x, goal.y);
+
+        SearchNode& startNode = space.touch(startIndex);
+        startNode.g = 0.0f;
+        startNode.f = heuristic(start.x, start.y, goal.x, goal.y);
+        startNode.state = NodeState::OPEN;
+        open.push(startIndex);
+
+        while (!open.empty()) {
+            int current = open.pop();
+            SearchNode& currentNode = space[current];
+            currentNode.state = NodeState::CLOSED;
+            lastExpandedNodes++;
+
+            if (current == goalIndex) {
+                reconstruct(goalIndex, path);
+                return true;
+            }
+
+            int cx = space.xOf(current);
+            int cy = space.yOf(current);
+
+            // Direções podadas a partir da direção de chegada
+            int pruned[4][2];
+            int count = 0;
+            if (currentNode.parent == -1) {
+                // Origem: sem direção de chegada, salta nas 4 direções
+                for (const auto& dir : GridTopology::Rect4::DIRS) {
+                    pruned[count][0] = dir[0];
+                    pruned[count][1] = dir[1];
+                    count++;
+                }
+            } else {
+                int px = space.xOf(currentNode.parent);
+                int py = space.yOf(currentNode.parent);
+                int dx = (cx > px) - (cx < px);
+                int dy = (cy > py) - (cy < py);
+                if (dx != 0) {
+                    pruned[0][0] = dx; pruned[0][1] = 0;
+                    pruned[1][0] = 0;  pruned[1][1] = -1;
+                    pruned[2][0] = 0;  pruned[2][1] = 1;
+                } else {
+                    pruned[0][0] = 0;  pruned[0][1] = dy;
+                    pruned[1][0] = -1; pruned[1][1] = 0;
+                    pruned[2][0] = 1;  pruned[2][1] = 0;
+                }
+                count = 3;
+            }
+
+            auto relax = [&](int dx, int dy) {
+                int jumpIndex = jump(cx, cy, dx, dy, isWalkable);
+                if (jumpIndex == -1) return;
+                SearchNode& successor = space.touch(jumpIndex);
+                if (successor.state == NodeState::CLOSED) return;
+                int jx = space.xOf(jumpIndex);
+                int jy = space.yOf(jumpIndex);
+                float newG = space[current].g + static_cast<float>(std::abs(jx - cx) + std::abs(jy - cy));
+                if (newG >= successor.g) return;
+                successor.g = newG;
+                successor.f = newG + heuristic(jx, jy, goal.x, goal.y);
+                successor.parent = current;
+                if (successor.state == NodeState::OPEN) {
+                    open.decreaseKey(jumpIndex);
+                } else {
+                    successor.state = NodeState::OPEN;
+                    open.push(jumpIndex);
+                }
+            };
+
+            for (int i = 0; i < count; ++i) {
+                relax(pruned[i][0], pruned[i][1]);
+            }
+        }
+        return false;
+    }
+
+    int getLastExpandedNodes() const { return lastExpandedNodes; }
+};
+
+#endif // JUMP_POINT_SEARCH_H
@@ -0,0 +1,138 @@
+#ifndef LANDMARK_HEURISTIC_H
+#define LANDMARK_HEURISTIC_H
+
+#include "src/Pathfinding/LandmarkTable.h"
+#include "src/Pathfinding/GridSnapshot.h"
+#include "src/Interfaces/IGridAdapter.h"
+#include <thread>
+#include <atomic>
+#include <memory>
+#include <cstdint>
+
+// =============================================================================
+// LandmarkHeuristic — Mantém a LandmarkTable do mapa atual
+// =============================================================================
+// As tabelas são calculadas numa thread de fundo sobre um GridSnapshot; a
+// thread principal só chama update() uma vez por frame, que instala a tabela
+// pronta e, se preciso, dispara a próxima construção.
+//
+// Edições (lidas do GridChangeJournal do grid):
+//   - célula BLOQUEADA: a tabela atual continua admissível (as distâncias
+//     reais só aumentaram), só fica mais fraca — segue em uso;
+//   - célula LIBERADA: a tabela pode superestimar e é desligada até a próxima
+//     construção (os motores voltam à heurística base).
+// A reconstrução é preguiçosa: espera `settleFrames` frames sem a versão do
+// diário mudar, para não refazer K BFSs a cada célula pintada.
+//
+// current() devolve a tabela utilizável agora ou nullptr. O ponteiro vale até
+// o próximo update(). Quem usa: A*/JPS/lote do Pathfinder, A* hexagonal, HPA*
+// (grafo abstrato), SlicedAStar, PathfindingService e D* Lite. A busca
+// cooperativa não usa: a estimativa dela já é a distância real (FlowField).
+//
+// Uma tabela pronta (lida de um MapFile) pode ser passada no construtor: se
+// for da versão atual do mapa, é usada direto e nenhuma construção começa.
+// =============================================================================
+class LandmarkHeuristic {
+public:
+    static constexpr int DEFAULT_LANDMARKS = 8;
+
+private:
+    IGridAdapter* grid;
+    GridType gridType;
+    int landmarkCount;
+    int settleFrames;
+
+    std::shared_ptr<const LandmarkTable> table;  // Em uso
+    std::unique_ptr<LandmarkTable> pending;  // Em construção (só a thread de fundo mexe)
+    std::thread builder;
+    std::atomic<bool> buildDone{false};
+    bool building = false;
+
+    uint64_t seenVersion = 0;       // Versão do diário no último update()
+    int framesSinceChange = 0;
+    int buildCount = 0;
+
+    void startBuild() {
+        auto snapshot = std::make_shared<const GridSnapshot>(*grid, gridType, grid->getJournal().getVersion());
+        pending = std::make_unique<LandmarkTable>();
+        buildDone = false;
+        building = true;
+        LandmarkTable* target = pending.get();
+        int count = landmarkCount;
+        builder = std::thread([this, target, snapshot, count]() {
+            target->build(snapshot->getWidth(), snapshot->getHeight(), snapshot->getGridType(),
+                          snapshot->getVersion(), count,
+                          [&snapshot](int x, int y) { return snapshot->isWalkable(x, y); });
+            buildDone = true;
+        });
+    }
+
+    void finishBuild() {
+        builder.join();
+        building = false;
+        table = std::move(pending);
+        buildCount++;
+    }
+
+public:
+    LandmarkHeuristic(IGridAdapter* g, GridType type, int landmarks = DEFAULT_LANDMARKS, int settle = 30,
+                      std::shared_ptr<const LandmarkTable> precomputed = nullptr)
+        : grid(g), gridType(type), landmarkCount(landmarks), settleFrames(settle) {
+        seenVersion = grid->getJournal().getVersion();
+        if (precomputed && precomputed->getVersion() == seenVersion &&
+            precomputed->getLandmarkCount() == landmarkCount && precomputed->getGridType() == gridType &&
+            precomputed->getWidth() == grid->GetWidth() && precomputed->getHeight() == grid->GetHeight()) {
+            table = std::move(precomputed);
+            return;
+        }
+        startBuild();
+    }
+
+    ~LandmarkHeuristic() {
+        if (builder.joinable()) builder.join();
+    }
+
+    LandmarkHeuristic(const LandmarkHeuristic&) = delete;
+    LandmarkHeuristic& operator=(const LandmarkHeuristic&) = delete;
+
+    // Chamado uma vez por frame na thread principal
+    void update() {
+        uint64_t gridVersion = grid->getJournal().getVersion();
+        if (gridVersion != seenVersion) {
+            seenVersion = gridVersion;
+            framesSinceChange = 0;
+        }
+        framesSinceChange++;
+        if (building && buildDone) finishBuild();
+        if (!building && (!table || table->getVersion() != gridVersion) &&
+            framesSinceChange >= settleFrames) {
+            startBuild();
+        }
+    }
+
+    // Bloqueia até a construção em andamento terminar (setup/benchmark)
+    void waitForBuild() {
+        if (building) finishBuild();
+    }
+
+    // Tabela admissível para o grid atual, ou nullptr
+    const LandmarkTable* current() const {
+        if (!table || table->getVersion() < grid->getJournal().getLastClearVersion()) return nullptr;
+        return table.get();
+    }
+
+    // Mesmo que current(), para quem guarda a tabela além do próximo update()
+    // (buscas em fatias, threads do PathfindingService, D* Lite)
+    std::shared_ptr<const LandmarkTable> shareCurrent() const {
+        return current() ? table : nullptr;
+    }
+
+    // Última tabela instalada (pode ser de uma versão anterior do mapa)
+    std::shared_ptr<const LandmarkTable> getTable() const { return table; }
+
+    bool isBuilding() const { return building; }
+    int getBuildCount() const { return buildCount; }
+    int getLandmarkCount() const { return landmarkCount; }
+};
+
+#endif // LANDMARK_HEURISTIC_H
@@ -0,0 +1,195 @@
+#ifndef LANDMARK_TABLE_H
+#define LANDMARK_TABLE_H
+
+#include "src/Pathfinding/GridTopology.h"
+#include "src/Core/Cell.h"
+#include "src/Core/GridType.h"
+#include <vector>
+#include <memory>
+#include <algorithm>
+#include <cstdint>
+#include <cstddef>
+#include <cstdlib>
+
+// =============================================================================
+// LandmarkTable — Heurística ALT (A*, Landmarks, desigualdade triangular)
+// =============================================================================
+// Em mapas tipo labirinto a Manhattan/distância hexagonal quase não ajuda e o
+// A* vira Dijkstra. Com K landmarks L e a distância real d(L, ·) de cada um
+// para todas as células, a desigualdade triangular dá o limite inferior
+//     h(n, g) = max_L |d(L, g) - d(L, n)|
+// que enxerga as paredes. O valor final é o máximo entre isso e a heurística
+// base da topologia — ambas admissíveis e consistentes, então o máximo também.
+//
+// Landmarks são escolhidos por "ponto mais distante": cada um é a célula mais
+// longe (em passos) dos já escolhidos, o que espalha os K pela borda do mapa.
+// As distâncias vêm de BFS (custo uniforme = Dijkstra).
+//
+// Armazenamento: uint16 intercalado por célula (dist[célula*K + k]), então a
+// consulta lê uma linha de cache por célula. 1000×1000 com 8 landmarks = 16 MB.
+// Distâncias acima de 65534 saturam — saturar não aumenta |a - b|, então a
+// heurística continua admissível; 65535 marca célula inalcançável/obstáculo.
+//
+// Tabelas construídas antes de obstáculos NOVOS continuam admissíveis
+// (bloquear só aumenta distâncias); liberar células as invalida. Quem decide
+// isso é o LandmarkHeuristic.
+//
+// adopt() monta a tabela sobre distâncias que já estão na memória (um
+// MapFile mapeado) sem copiá-las; build() calcula e guarda as suas.
+// =============================================================================
+class LandmarkTable {
+public:
+    static constexpr uint16_t UNREACHABLE = 0xFFFF;
+
+private:
+    int width = 0;
+    int height = 0;
+    int landmarkCount = 0;
+    GridType gridType = GridType::RECTANGULAR;
+    uint64_t version = 0;
+    std::vector<Cell> landmarks;
+    std::vector<uint16_t> ownDistances;      // Preenchido por build()
+    const uint16_t* distances = nullptr;     // [célula * landmarkCount + k]
+    std::shared_ptr<const void> owner;       // Dono da memória de adopt()
+
+    float baseHeuristic(int x1, int y1, int x2, int y2) const {
+        return gridType == GridType::HEXAGONAL ?
+            GridTopology::HexOddQ::heuristic(x1, y1, x2, y2) :
+            GridTopology::Rect4::heuristic(x1, y1, x2, y2);
+    }
+
+    // BFS a partir de `source`; grava as distâncias na coluna k e devolve
+    // a distância de cada célula em `scratch` (-1 = não alcançada)
+    template <typename WalkableFn>
+    void fillLandmark(int k, int source, WalkableFn& isWalkable,
+                      std::vector<int32_t>& scratch, std::vector<int>& queue) {
+        std::fill(scratch.begin(), scratch.end(), -1);
+        queue.clear();
+        scratch[source] = 0;
+        queue.push_back(source);
+        Cell adj[6];
+        for (size_t head = 0; head < queue.size(); ++head) {
+            int current = queue[head];
+            int count = GridTopology::neighbors(gridType, current % width, current / width,
+                                                width, height, adj);
+            for (int i = 0; i < count; ++i) {
+                int n = adj[i].y * width + adj[i].x;
+                if (scratch[n] != -1 || !isWalkable(adj[i].x, adj[i].y)) continue;
+                scratch[n] = scratch[current] + 1;
+                queue.push_back(n);
+            }
+        }
+        for (size_t cell = 0; cell < scratch.size(); ++cell) {
+            int32_t d = scratch[cell];
+            ownDistances[cell * landmarkCount + k] =
+                d < 0 ? UNREACHABLE : (uint16_t)std::min<int32_t>(d, UNREACHABLE - 1);
+        }
+    }
+
+public:
+    LandmarkTable() = default;
+    // `distances` aponta para ownDistances: copiar deixaria o ponteiro na cópia antiga
+    LandmarkTable(const LandmarkTable&) = delete;
+    LandmarkTable& operator=(const LandmarkTable&) = delete;
+
+    // Escolhe `count` landmarks e calcula as tabelas (pode rodar em
+    // qualquer thread: só lê `isWalkable`)
+    template <typename WalkableFn>
+    void build(int w, int h, GridType type, uint64_t ver, int count, WalkableFn&& isWalkable) {
+        width = w;
+        height = h;
+        gridType = type;
+        version = ver;
+        landmarkCount = std::max(1, count);
+        landmarks.clear();
+        owner.reset();
+        ownDistances.assign((size_t)w * h * landmarkCount, UNREACHABLE);
+        distances = ownDistances.data();
+
+        // Ponto de partida: a célula livre mais próxima do centro (em varredura)
+        int seed = -1;
+        for (int offset = 0; offset < w * h && seed == -1; ++offset) {
+            int cell = ((h / 2) * w + w / 2 + offset) % (w * h);
+            if (isWalkable(cell % w, cell / w)) seed = cell;
+        }
+        if (seed == -1) {
+            landmarkCount = 0;
+            ownDistances.clear();
+            distances = nullptr;
+            return;
+        }
+
+        std::vector<int32_t> scratch((size_t)w * h);
+        std::vector<int32_t> nearest((size_t)w * h, INT32_MAX);  // Distância ao landmark mais próximo
+        std::vector<int> queue;
+        queue.reserve((size_t)w * h);
+
+        // A coluna 0 é sobrescrita logo abaixo; aqui só serve para achar o
+        // primeiro landmark (o mais longe da semente)
+        fillLandmark(0, seed, isWalkable, scratch, queue);
+        int next = (int)std::distance(scratch.begin(), std::max_element(scratch.begin(), scratch.end()));
+
+        for (int k = 0; k < landmarkCount; ++k) {
+            landmarks.push_back({next % w, next / w});
+            fillLandmark(k, next, isWalkable, scratch, queue);
+
+            int best = -1;
+            int32_t bestDistance = 0;
+            for (size_t cell = 0; cell < scratch.size(); ++cell) {
+                if (scratch[cell] < 0) continue;
+                nearest[cell] = std::min(nearest[cell], scratch[cell]);
+                if (nearest[cell] > bestDistance) {
+                    bestDistance = nearest[cell];
+                    best = (int)cell;
+                }
+            }
+            if (best != -1) next = best;  // Sem célula nova: repete (inofensivo)
+        }
+    }
+
+    // Usa distâncias calculadas antes (mesmo layout de build()); `memoryOwner`
+    // mantém `data` viva enquanto a tabela existir
+    void adopt(int w, int h, GridType type, uint64_t ver, const Cell* cells, int count,
+               const uint16_t* data, std::shared_ptr<const void> memoryOwner) {
+        width = w;
+        height = h;
+        gridType = type;
+        version = ver;
+        landmarkCount = count;
+        landmarks.assign(cells, cells + count);
+        ownDistances.clear();
+        distances = data;
+        owner = std::move(memoryOwner);
+    }
+
+    // Limite inferior para a distância entre (x1, y1) e (x2, y2)
+    float estimate(int x1, int y1, int x2, int y2) const {
+        float best = baseHeuristic(x1, y1, x2, y2);
+        if (landmarkCount == 0 || x1 < 0 || x1 >= width || y1 < 0 || y1 >= height ||
+            x2 < 0 || x2 >= width || y2 < 0 || y2 >= height) {
+            return best;
+        }
+        const uint16_t* a = &distances[((size_t)y1 * width + x1) * landmarkCount];
+        const uint16_t* b = &distances[((size_t)y2 * width + x2) * landmarkCount];
+        for (int k = 0; k < landmarkCount; ++k) {
+            if (a[k] == UNREACHABLE || b[k] == UNREACHABLE) continue;
+            float d = (float)std::abs((int)a[k] - (int)b[k]);
+            if (d > best) best = d;
+        }
+        return best;
+    }
+
+    // Functor no formato heuristic(x1, y1, x2, y2) esperado pelos motores
+    float operator()(int x1, int y1, int x2, int y2) const { return estimate(x1, y1, x2, y2); }
+
+    int getWidth() const { return width; }
+    int getHeight() const { return height; }
+    GridType getGridType() const { return gridType; }
+    uint64_t getVersion() const { return version; }
+    const std::vector<Cell>& getLandmarks() const { return landmarks; }
+    int getLandmarkCount() const { return landmarkCount; }
+    const uint16_t* getDistances() const { return distances; }
+    size_t getMemoryBytes() const { return (size_t)width * height * landmarkCount * sizeof(uint16_t); }
+};
+
+#endif // LANDMARK_TABLE_H
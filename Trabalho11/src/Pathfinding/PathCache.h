@@ -0,0 +1,213 @@
+#ifndef PATH_CACHE_H
+#define PATH_CACHE_H
+
+#include "src/Interfaces/IObserver.h"
+#include "src/Observer/GridChangeNotifier.h"
+#include "src/Core/Cell.h"
+#include "src/Core/GridType.h"
+#include "raylib.h"
+#include <list>
+#include <unordered_map>
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+
+// Chave de uma consulta: origem, destino, topologia e versão do grid
+struct PathCacheKey {
+    Cell start;
+    Cell goal;
+    GridType topology;
+    uint64_t version;
+
+    bool operator==(const PathCacheKey& other) const {
+        return start == other.start && goal == other.goal &&
+               topology == other.topology && version == other.version;
+    }
+};
+
+struct PathCacheKeyHash {
+    size_t operator()(const PathCacheKey& key) const {
+        size_t h = std::hash<int>()(key.start.x);
+        h = h * 31 + std::hash<int>()(key.start.y);
+        h = h * 31 + std::hash<int>()(key.goal.x);
+        h = h * 31 + std::hash<int>()(key.goal.y);
+        h = h * 31 + std::hash<int>()(static_cast<int>(key.topology));
+        h = h * 31 + std::hash<uint64_t>()(key.version);
+        return h;
+    }
+};
+
+// =============================================================================
+// PathCache — Cache LRU de caminhos já calculados
+// =============================================================================
+// Respawns, redo de SpawnAgentCommand e reexecuções do benchmark repetem as
+// mesmas consultas no mesmo mapa. O cache guarda o resultado (inclusive
+// "sem caminho") até um limite de entradas, descartando o menos usado.
+//
+// Invalidação ao mudar obstáculos (via GridChangeNotifier):
+//   - célula BLOQUEADA: só caminhos que passam por ela ficam inválidos; os
+//     demais continuam válidos e ótimos (bloquear nunca encurta caminhos).
+//     Esses são removidos seletivamente pelo índice célula -> entradas.
+//   - célula LIBERADA: qualquer resultado pode ter ficado subótimo (ou um
+//     "sem caminho" pode ter passado a existir). A versão do grid avança e
+//     as entradas antigas deixam de casar, saindo do cache pelo LRU.
+// Edições em lote (REGION_CHANGED) seguem a mesma regra para a caixa toda.
+// =============================================================================
+class PathCache : public IObserver {
+private:
+    struct Entry {
+        PathCacheKey key;
+        std::vector<Vector2> path;
+    };
+
+    IGridAdapter* grid;
+    size_t capacity;
+    uint64_t version = 0;
+
+    std::list<Entry> entries;  // Frente = mais recente
+    std::unordered_map<PathCacheKey, std::list<Entry>::iterator, PathCacheKeyHash> index;
+    std::unordered_map<int, std::vector<PathCacheKey>> entriesByCell;
+
+    long long hits = 0;
+    long long misses = 0;
+    long long invalidations = 0;
+
+    int cellKey(int x, int y) const { return (y << 16) ^ x; }
+
+    // Chama fn(x, y) para cada célula de que a entrada depende (origem,
+    // destino e o caminho; o destino/origem podem não constar no caminho)
+    template <typename Fn>
+    static void forEachCell(const Entry& entry, Fn&& fn) {
+        fn(entry.key.start.x, entry.key.start.y);
+        fn(entry.key.goal.x, entry.key.goal.y);
+        for (const Vector2& p : entry.path) {
+            fn((int)p.x, (int)p.y);
+        }
+    }
+
+    void erase(std::list<Entry>::iterator it) {
+        const PathCacheKey key = it->key;
+        forEachCell(*it, [&](int x, int y) {
+            auto cellIt = entriesByCell.find(cellKey(x, y));
+            if (cellIt == entriesByCell.end()) return;
+            auto& keys = cellIt->second;
+            auto found = std::find(keys.begin(), keys.end(), key);
+            if (found != keys.end()) {
+                *found = keys.back();
+                keys.pop_back();
+            }
+            if (keys.empty()) entriesByCell.erase(cellIt);
+        });
+        index.erase(key);
+        entries.erase(it);
+    }
+
+    // Remove as entradas cujo caminho passa pela célula bloqueada
+    void invalidateCell(int x, int y) {
+        auto cellIt = entriesByCell.find(cellKey(x, y));
+        if (cellIt == entriesByCell.end()) return;
+        std::vector<PathCacheKey> affected = cellIt->second;
+        for (const auto& key : affected) {
+            auto it = index.find(key);
+            if (it != index.end()) {
+                erase(it->second);
+                invalidations++;
+            }
+        }
+    }
+
+public:
+    PathCache(IGridAdapter* g, size_t maxEntries = 1024) : grid(g), capacity(maxEntries) {}
+
+    PathCacheKey makeKey(Cell start, Cell goal, GridType topology) const {
+        return {start, goal, topology, version};
+    }
+
+    // Retorna true e copia o caminho se a consulta está no cache
+    bool lookup(const PathCacheKey& key, std::vector<Vector2>& path) {
+        auto it = index.find(key);
+        if (it == index.end()) {
+            misses++;
+            return false;
+        }
+        entries.splice(entries.begin(), entries, it->second);
+        path = it->second->path;
+        hits++;
+        return true;
+    }
+
+    void store(const PathCacheKey& key, const std::vector<Vector2>& path) {
+        if (capacity == 0) return;
+        auto existing = index.find(key);
+        if (existing != index.end()) erase(existing->second);
+
+        entries.push_front({key, path});
+        index[key] = entries.begin();
+        forEachCell(entries.front(), [&](int x, int y) {
+            auto& keys = entriesByCell[cellKey(x, y)];
+            if (std::find(keys.begin(), keys.end(), key) == keys.end()) keys.push_back(key);
+        });
+
+        while (entries.size() > capacity) {
+            erase(std::prev(entries.end()));
+        }
+    }
+
+    void onNotify(const std::string& event, void* data) override {
+        if (!data) return;
+        if (event == GridEvents::OBSTACLE_CHANGED) {
+            auto* change = static_cast<GridChangeData*>(data);
+            if (change->grid != grid) return;
+            if (change->isObstacle) {
+                invalidateCell(change->x, change->y);
+            } else {
+                version++;
+            }
+        } else if (event == GridEvents::REGION_CHANGED) {
+            // Lote: mesma regra, aplicada à caixa inteira
+            auto* region = static_cast<GridRegionData*>(data);
+            if (region->grid != grid) return;
+            if (region->cleared) {
+                version++;
+                return;
+            }
+            for (int y = region->area.y0; y <= region->area.y1; ++y) {
+                for (int x = region->area.x0; x <= region->area.x1; ++x) {
+                    invalidateCell(x, y);
+                }
+            }
+        } else if (event == GridEvents::GRID_REPLACED) {
+            // Os caminhos eram do mapa antigo
+            if (static_cast<GridReplacedData*>(data)->previous != grid) return;
+            clear();
+            grid = nullptr;
+        }
+    }
+
+    void clear() {
+        entries.clear();
+        index.clear();
+        entriesByCell.clear();
+        version++;
+    }
+
+    // === Contadores ===
+    long long getHits() const { return hits; }
+    long long getMisses() const { return misses; }
+    long long getInvalidations() const { return invalidations; }
+    size_t getSize() const { return entries.size(); }
+    uint64_t getVersion() const { return version; }
+
+    double getHitRate() const {
+        long long total = hits + misses;
+        return total > 0 ? (double)hits / total : 0.0;
+    }
+
+    void resetCounters() {
+        hits = 0;
+        misses = 0;
+        invalidations = 0;
+    }
+};
+
+#endif // PATH_CACHE_H
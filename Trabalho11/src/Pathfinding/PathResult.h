@@ -0,0 +1,20 @@
+#ifndef PATH_RESULT_H
+#define PATH_RESULT_H
+
+#include "src/Core/Cell.h"
+#include "raylib.h"
+#include <vector>
+#include <cstdint>
+
+// Resultado de uma requisição de caminho adiada (assíncrona ou fatiada),
+// entregue na thread principal
+struct PathResult {
+    uint64_t ticket;
+    Cell start;
+    Cell goal;
+    std::vector<Vector2> path;  // Vazio = sem caminho
+    int expandedNodes;
+    uint64_t gridVersion;       // Versão do grid quando a busca começou
+};
+
+#endif // PATH_RESULT_H
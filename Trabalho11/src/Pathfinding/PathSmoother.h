@@ -0,0 +1,81 @@
+#ifndef PATH_SMOOTHER_H
+#define PATH_SMOOTHER_H
+
+#include "src/Core/Cell.h"
+#include "raylib.h"
+#include <vector>
+#include <cmath>
+#include <algorithm>
+
+// =============================================================================
+// PathSmoother — Pós-processamento any-angle ("string pulling")
+// =============================================================================
+// As buscas devolvem um waypoint por célula: o agente anda em escada e troca
+// de waypoint a cada célula. Aqui o caminho é encurtado mantendo só os cantos:
+// a partir de uma âncora, avança enquanto houver linha de visão até o próximo
+// waypoint; quando a visão quebra, o anterior vira canto e nova âncora.
+//
+// A linha de visão é testada no espaço do mundo (o mesmo em que o agente
+// anda), amostrando o segmento entre os centros das células a cada
+// `step` pixels, no eixo e deslocado ±`clearance` para os lados — uma faixa
+// da largura do agente. Cada amostra é convertida em célula por `toCell`,
+// então o mesmo código serve ao grid retangular e ao hexagonal.
+//
+// O resultado é um subconjunto dos waypoints originais (coordenadas de grid,
+// origem e destino inclusos).
+// =============================================================================
+class PathSmoother {
+public:
+    // Há passagem livre, com folga lateral, entre os pontos do mundo a e b?
+    template <typename ToCellFn, typename WalkableFn>
+    static bool lineOfSight(Vector2 a, Vector2 b, ToCellFn&& toCell, WalkableFn&& isWalkable,
+                            float step, float clearance) {
+        float dx = b.x - a.x;
+        float dy = b.y - a.y;
+        float length = std::sqrt(dx * dx + dy * dy);
+        if (length < 0.001f) return true;
+
+        // Normal unitária para as duas bordas da faixa
+        float nx = -dy / length * clearance;
+        float ny = dx / length * clearance;
+        int samples = std::max(1, (int)std::ceil(length / step));
+
+        for (int i = 0; i <= samples; ++i) {
+            float t = (float)i / samples;
+            Vector2 p = {a.x + dx * t, a.y + dy * t};
+            Cell c = toCell(p);
+            if (!isWalkable(c.x, c.y)) return false;
+            if (clearance > 0.0f) {
+                c = toCell(Vector2{p.x + nx, p.y + ny});
+                if (!isWalkable(c.x, c.y)) return false;
+                c = toCell(Vector2{p.x - nx, p.y - ny});
+                if (!isWalkable(c.x, c.y)) return false;
+            }
+        }
+        return true;
+    }
+
+    // Mantém só os waypoints em que a linha de visão quebra
+    template <typename ToWorldFn, typename ToCellFn, typename WalkableFn>
+    static std::vector<Vector2> smooth(const std::vector<Vector2>& path, ToWorldFn&& toWorld,
+                                       ToCellFn&& toCell, WalkableFn&& isWalkable,
+                                       float step, float clearance) {
+        if (path.size() <= 2) return path;
+
+        auto world = [&toWorld](const Vector2& cell) { return toWorld((int)cell.x, (int)cell.y); };
+
+        std::vector<Vector2> result;
+        result.push_back(path.front());
+        Vector2 anchorWorld = world(path[0]);
+
+        for (size_t k = 2; k < path.size(); ++k) {
+            if (lineOfSight(anchorWorld, world(path[k]), toCell, isWalkable, step, clearance)) continue;
+            anchorWorld = world(path[k - 1]);
+            result.push_back(path[k - 1]);
+        }
+        result.push_back(path.back());
+        return result;
+    }
+};
+
+#endif // PATH_SMOOTHER_H
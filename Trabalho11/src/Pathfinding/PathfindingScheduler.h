@@ -0,0 +1,215 @@
+#ifndef PATHFINDING_SCHEDULER_H
+#define PATHFINDING_SCHEDULER_H
+
+#include "src/Pathfinding/SlicedAStar.h"
+#include "src/Pathfinding/PathResult.h"
+#include <vector>
+#include <memory>
+#include <chrono>
+#include <algorithm>
+#include <cstdint>
+
+// =============================================================================
+// PathfindingScheduler — Orçamento de busca por frame
+// =============================================================================
+// Recebe requisições (submit) e, a cada frame, runFrame() gasta no máximo
+// `expansionBudget` expansões ou `timeBudgetUs` microssegundos nelas, o que
+// vier primeiro. Buscas que não terminam continuam no próximo frame.
+//
+// Até `maxActive` buscas ficam abertas ao mesmo tempo (cada uma com seu
+// SlicedAStar); as demais esperam. Quem espera e quem recebe orçamento
+// primeiro é decidido pela prioridade (maior primeiro; empate = ordem de
+// chegada). O orçamento do frame é dividido entre as buscas ativas nessa
+// ordem: cada uma recebe a parte igual do que sobrou, e o que ela não usar
+// passa para as seguintes.
+//
+// Como uma busca pode atravessar frames em que o mapa foi editado, o
+// resultado carrega a versão do grid (GridChangeJournal) do início da busca
+// para quem o recebe poder validá-lo.
+// =============================================================================
+class PathfindingScheduler {
+private:
+    struct Request {
+        uint64_t ticket;
+        Cell start;
+        Cell goal;
+        int priority;
+        std::shared_ptr<const LandmarkTable> landmarks;  // Heurística ALT (opcional)
+    };
+
+    struct Slot {
+        SlicedAStar search;
+        Request request = {0, {0, 0}, {0, 0}, 0, nullptr};
+        uint64_t gridVersion = 0;
+        bool busy = false;
+    };
+
+    IGridAdapter* grid;
+    GridType gridType;
+    std::vector<std::unique_ptr<Slot>> slots;
+    std::vector<Request> waiting;
+    std::vector<PathResult> completed;
+    uint64_t nextTicket = 1;
+
+    int expansionBudget;
+    double timeBudgetUs;
+
+    // Uso do orçamento
+    int lastFrameExpansions = 0;
+    double lastFrameTimeUs = 0.0;
+    long long totalFrames = 0;
+    double totalBudgetUse = 0.0;        // Soma das frações do orçamento usadas
+    long long exhaustedFrames = 0;      // Frames em que o orçamento acabou
+
+    static bool higherPriority(const Request& a, const Request& b) {
+        if (a.priority != b.priority) return a.priority > b.priority;
+        return a.ticket < b.ticket;
+    }
+
+    void finish(Slot& slot) {
+        PathResult result{slot.request.ticket, slot.request.start, slot.request.goal, {},
+                          slot.search.getExpandedNodes(), slot.gridVersion};
+        for (const Cell& cell : slot.search.getPath()) {
+            result.path.push_back({(float)cell.x, (float)cell.y});
+        }
+        completed.push_back(std::move(result));
+        slot.request.landmarks.reset();
+        slot.busy = false;
+    }
+
+    // Ocupa slots livres com as requisições de maior prioridade
+    void fillSlots() {
+        if (waiting.empty()) return;
+        std::stable_sort(waiting.begin(), waiting.end(), higherPriority);
+        size_t next = 0;
+        for (auto& slot : slots) {
+            if (slot->busy || next >= waiting.size()) continue;
+            slot->request = waiting[next++];
+            slot->gridVersion = getGridVersion();
+            slot->busy = true;
+            slot->search.begin(grid, gridType, slot->request.start, slot->request.goal,
+                               slot->request.landmarks);
+            if (slot->search.isDone()) finish(*slot);
+        }
+        waiting.erase(waiting.begin(), waiting.begin() + next);
+    }
+
+public:
+    PathfindingScheduler(IGridAdapter* g, GridType type, int expansionsPerFrame = 2000,
+                         double microsecondsPerFrame = 2000.0, int maxActive = 8)
+        : grid(g), gridType(type), expansionBudget(expansionsPerFrame),
+          timeBudgetUs(microsecondsPerFrame) {
+        for (int i = 0; i < std::max(1, maxActive); ++i) {
+            slots.push_back(std::make_unique<Slot>());
+        }
+    }
+
+    uint64_t submit(Cell start, Cell goal, int priority = 0,
+                    std::shared_ptr<const LandmarkTable> landmarks = nullptr) {
+        uint64_t ticket = nextTicket++;
+        waiting.push_back({ticket, start, goal, priority, std::move(landmarks)});
+        return ticket;
+    }
+
+    // Descarta uma requisição (esperando ou em andamento)
+    void cancel(uint64_t ticket) {
+        waiting.erase(std::remove_if(waiting.begin(), waiting.end(),
+            [ticket](const Request& r) { return r.ticket == ticket; }), waiting.end());
+        for (auto& slot : slots) {
+            if (slot->busy && slot->request.ticket == ticket) {
+                slot->search.cancel();
+                slot->request.landmarks.reset();
+                slot->busy = false;
+            }
+        }
+    }
+
+    // Executa as buscas dentro do orçamento deste frame
+    void runFrame() {
+        using Clock = std::chrono::steady_clock;
+        static const int CHUNK = 64;  // Expansões entre consultas ao relógio
+
+        auto frameStart = Clock::now();
+        int remaining = expansionBudget;
+        bool outOfTime = false;
+        fillSlots();
+
+        while (remaining > 0 && !outOfTime) {
+            std::vector<Slot*> active;
+            for (auto& slot : slots) {
+                if (slot->busy) active.push_back(slot.get());
+            }
+            if (active.empty()) break;
+            std::sort(active.begin(), active.end(), [](const Slot* a, const Slot* b) {
+                return higherPriority(a->request, b->request);
+            });
+
+            for (size_t i = 0; i < active.size() && remaining > 0 && !outOfTime; ++i) {
+                Slot& slot = *active[i];
+                int share = std::max(1, remaining / (int)(active.size() - i));
+                while (share > 0 && slot.search.isRunning()) {
+                    int used = slot.search.step(std::min(share, CHUNK));
+                    share -= used;
+                    remaining -= used;
+                    double elapsed = std::chrono::duration<double, std::micro>(
+                        Clock::now() - frameStart).count();
+                    if (elapsed >= timeBudgetUs) {
+                        outOfTime = true;
+                        break;
+                    }
+                }
+                if (slot.search.isDone()) finish(slot);
+            }
+            fillSlots();  // Slots liberados recebem novas buscas ainda neste frame
+        }
+
+        lastFrameExpansions = expansionBudget - remaining;
+        lastFrameTimeUs = std::chrono::duration<double, std::micro>(Clock::now() - frameStart).count();
+        if (lastFrameExpansions > 0) {
+            totalFrames++;
+            totalBudgetUse += std::max((double)lastFrameExpansions / expansionBudget,
+                                       lastFrameTimeUs / timeBudgetUs);
+            if (remaining <= 0 || outOfTime) exhaustedFrames++;
+        }
+    }
+
+    std::vector<PathResult> takeCompleted() {
+        std::vector<PathResult> results;
+        results.swap(completed);
+        return results;
+    }
+
+    size_t getPendingCount() const {
+        size_t count = waiting.size();
+        for (const auto& slot : slots) {
+            if (slot->busy) count++;
+        }
+        return count;
+    }
+
+    void setBudget(int expansionsPerFrame, double microsecondsPerFrame) {
+        expansionBudget = std::max(1, expansionsPerFrame);
+        timeBudgetUs = std::max(1.0, microsecondsPerFrame);
+    }
+
+    int getExpansionBudget() const { return expansionBudget; }
+    double getTimeBudgetUs() const { return timeBudgetUs; }
+    int getLastFrameExpansions() const { return lastFrameExpansions; }
+    double getLastFrameTimeUs() const { return lastFrameTimeUs; }
+    long long getExhaustedFrames() const { return exhaustedFrames; }
+    // Versão atual do mapa (diário do grid)
+    uint64_t getGridVersion() const { return grid->getJournal().getVersion(); }
+
+    // Fração média do orçamento usada nos frames com busca (0..1+)
+    double getAverageBudgetUse() const {
+        return totalFrames > 0 ? totalBudgetUse / totalFrames : 0.0;
+    }
+
+    void resetCounters() {
+        totalFrames = 0;
+        totalBudgetUse = 0.0;
+        exhaustedFrames = 0;
+    }
+};
+
+#endif // PATHFINDING_SCHEDULER_H
@@ -0,0 +1,203 @@
+#ifndef PATHFINDING_SERVICE_H
+#define PATHFINDING_SERVICE_H
+
+#include "src/Pathfinding/GridSnapshot.h"
+#include "src/Pathfinding/PathResult.h"
+#include "src/Pathfinding/GridAStar.h"
+#include "src/Pathfinding/JumpPointSearch.h"
+#include "src/Pathfinding/HexAStar.h"
+#include "src/Pathfinding/GridHeuristics.h"
+#include "src/Pathfinding/LandmarkTable.h"
+#include "src/Interfaces/IGridAdapter.h"
+#include "src/Core/PathfindingAlgorithm.h"
+#include "src/Core/Cell.h"
+#include "raylib.h"
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <set>
+#include <memory>
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+
+// =============================================================================
+// PathfindingService — Buscas de caminho num pool de threads
+// =============================================================================
+// Quando muitos agentes nascem juntos (tecla R, setup do benchmark), rodar
+// todas as buscas dentro do frame causa picos. Aqui a thread principal só
+// enfileira a requisição (submit) e recebe um ticket; as threads do pool
+// fazem a busca sobre um GridSnapshot imutável.
+//
+// Entrega: collect() é chamado num ponto fixo do frame e devolve os
+// resultados prontos EM ORDEM DE SUBMISSÃO — um resultado só sai depois de
+// todos os tickets anteriores, então a aplicação é determinística
+// independentemente de qual thread terminou primeiro.
+//
+// Cada thread tem seus próprios motores (GridAStar/JumpPointSearch/HexAStar),
+// então nada de estado de busca é compartilhado. O hexagonal usa o mesmo
+// HexAStar do FindPathHex, aqui sobre o snapshot. A heurística ALT, quando
+// pedida, vai junto com a requisição (a tabela é imutável e a requisição
+// segura uma referência até a busca terminar).
+// =============================================================================
+class PathfindingService {
+private:
+    struct PathRequest {
+        uint64_t ticket;
+        Cell start;
+        Cell goal;
+        PathfindingAlgorithm algorithm;
+        std::shared_ptr<const GridSnapshot> snapshot;
+        std::shared_ptr<const LandmarkTable> landmarks;
+    };
+
+    IGridAdapter* grid;
+    GridType gridType;
+
+    std::vector<std::thread> workers;
+    std::mutex mutex;
+    std::condition_variable hasWork;
+    std::deque<PathRequest> requests;
+    std::map<uint64_t, PathResult> finished;  // Prontos, aguardando a vez
+    std::set<uint64_t> cancelled;             // Descartados: pulados na entrega
+    bool stopping = false;
+
+    // Estado da thread principal
+    uint64_t nextTicket = 1;
+    uint64_t nextToDeliver = 1;
+    std::shared_ptr<const GridSnapshot> snapshot;
+
+    void workerLoop() {
+        GridAStar astar;
+        JumpPointSearch jps;
+        HexAStar hexAStar;
+        std::vector<Cell> cells;
+
+        while (true) {
+            PathRequest request;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                hasWork.wait(lock, [this] { return stopping || !requests.empty(); });
+                if (stopping) return;
+                request = std::move(requests.front());
+                requests.pop_front();
+            }
+
+            const GridSnapshot& snap = *request.snapshot;
+            auto walkable = [&snap](int x, int y) { return snap.isWalkable(x, y); };
+            const LandmarkTable* landmarks = request.landmarks.get();
+            bool found = false;
+            int expanded = 0;
+            if (snap.getGridType() == GridType::HEXAGONAL) {
+                found = landmarks ?
+                    hexAStar.findPath(snap.getWidth(), snap.getHeight(), request.start, request.goal,
+                                      walkable, *landmarks, cells) :
+                    hexAStar.findPath(snap.getWidth(), snap.getHeight(), request.start, request.goal,
+                                      walkable, cells);
+                expanded = hexAStar.getLastExpandedNodes();
+            } else {
+                auto heuristic = [landmarks](int x1, int y1, int x2, int y2) {
+                    return landmarks ? landmarks->estimate(x1, y1, x2, y2) : GridHeuristics::manhattan(x1, y1, x2, y2);
+                };
+                if (request.algorithm == PathfindingAlgorithm::JPS) {
+                    found = jps.findPath(snap.getWidth(), snap.getHeight(), request.start, request.goal,
+                                         walkable, heuristic, cells);
+                    expanded = jps.getLastExpandedNodes();
+                } else {
+                    found = astar.findPath(snap.getWidth(), snap.getHeight(), request.start, request.goal,
+                                           walkable, heuristic, cells);
+                    expanded = astar.getLastExpandedNodes();
+                }
+            }
+
+            PathResult result{request.ticket, request.start, request.goal, {}, expanded, snap.getVersion()};
+            if (found) {
+                result.path.reserve(cells.size());
+                for (const auto& cell : cells) {
+                    result.path.push_back({(float)cell.x, (float)cell.y});
+                }
+            }
+
+            std::lock_guard<std::mutex> lock(mutex);
+            finished.emplace(result.ticket, std::move(result));
+        }
+    }
+
+public:
+    PathfindingService(IGridAdapter* g, GridType type, int threadCount = 0) : grid(g), gridType(type) {
+        if (threadCount <= 0) {
+            threadCount = std::max(1, (int)std::thread::hardware_concurrency() - 1);
+        }
+        for (int i = 0; i < threadCount; ++i) {
+            workers.emplace_back(&PathfindingService::workerLoop, this);
+        }
+    }
+
+    ~PathfindingService() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        hasWork.notify_all();
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
+
+    PathfindingService(const PathfindingService&) = delete;
+    PathfindingService& operator=(const PathfindingService&) = delete;
+
+    // Enfileira uma busca; retorna o ticket que identifica o resultado.
+    // `landmarks` precisa ser admissível para o grid no momento do submit.
+    uint64_t submit(Cell start, Cell goal, PathfindingAlgorithm algorithm = PathfindingAlgorithm::ASTAR,
+                    std::shared_ptr<const LandmarkTable> landmarks = nullptr) {
+        // Edições no grid (versão do diário) tornam o snapshot atual obsoleto
+        uint64_t gridVersion = getGridVersion();
+        if (!snapshot || snapshot->getVersion() != gridVersion) {
+            snapshot = std::make_shared<const GridSnapshot>(*grid, gridType, gridVersion);
+        }
+        uint64_t ticket = nextTicket++;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            requests.push_back({ticket, start, goal, algorithm, snapshot, std::move(landmarks)});
+        }
+        hasWork.notify_one();
+        return ticket;
+    }
+
+    // Descarta uma requisição. Se ainda está na fila, nem é buscada; se já
+    // está em busca, o resultado é jogado fora. Os tickets seguintes continuam
+    // saindo em ordem.
+    void cancel(uint64_t ticket) {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto queued = std::find_if(requests.begin(), requests.end(),
+            [ticket](const PathRequest& r) { return r.ticket == ticket; });
+        if (queued != requests.end()) {
+            requests.erase(queued);
+            finished.emplace(ticket, PathResult{ticket, {}, {}, {}, 0, 0});
+        }
+        cancelled.insert(ticket);
+    }
+
+    // Ponto de sincronização: resultados prontos, em ordem de submissão
+    std::vector<PathResult> collect() {
+        std::vector<PathResult> ready;
+        std::lock_guard<std::mutex> lock(mutex);
+        for (auto it = finished.find(nextToDeliver); it != finished.end();
+             it = finished.find(nextToDeliver)) {
+            if (cancelled.erase(it->first) == 0) ready.push_back(std::move(it->second));
+            finished.erase(it);
+            nextToDeliver++;
+        }
+        return ready;
+    }
+
+    // Requisições ainda não entregues (na fila, em busca ou aguardando a vez)
+    size_t getPendingCount() const { return (size_t)(nextTicket - nextToDeliver); }
+    size_t getThreadCount() const { return workers.size(); }
+    uint64_t getGridVersion() const { return grid->getJournal().getVersion(); }
+};
+
+#endif // PATHFINDING_SERVICE_H
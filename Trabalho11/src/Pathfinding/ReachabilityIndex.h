@@ -0,0 +1,322 @@
+#ifndef REACHABILITY_INDEX_H
+#define REACHABILITY_INDEX_H
+
+#include "src/Interfaces/IGridAdapter.h"
+#include "src/Pathfinding/GridTopology.h"
+#include "src/Interfaces/IObserver.h"
+#include "src/Observer/GridChangeNotifier.h"
+#include "src/Core/Cell.h"
+#include "src/Core/GridType.h"
+#include <vector>
+#include <deque>
+#include <algorithm>
+#include <cstdint>
+
+// =============================================================================
+// ReachabilityIndex — Componentes conexas das células livres
+// =============================================================================
+// Com o alvo murado, cada agente bloqueado rodava um A* exaustivo por frame.
+// Com o índice, "origem e destino estão na mesma componente?" custa O(1) e a
+// busca só roda quando existe caminho.
+//
+// Cada célula livre guarda um rótulo; rótulos são unidos por union-find.
+// Manutenção incremental (via GridChangeNotifier):
+//   - célula LIBERADA: recebe o rótulo de um vizinho e une os rótulos de
+//     todos os vizinhos (junção de regiões) — O(vizinhos).
+//   - célula BLOQUEADA: pode separar a região. Uma BFS parte de cada vizinho
+//     livre, intercaladas passo a passo; BFSs que se encontram são a mesma
+//     região. Quando sobra só uma região ainda em expansão, as que
+//     terminaram ganham rótulos novos e a restante mantém o antigo. O custo
+//     fica limitado pelo tamanho das partes MENORES, não do mapa.
+//   - edição em lote (REGION_CHANGED): rotula tudo de novo — uma BFS do mapa
+//     sai mais barata que repetir as separações célula a célula.
+//
+// getVersion() muda quando uma célula é liberada ou uma região se separa:
+// agentes bloqueados só precisam tentar de novo quando a versão mudar.
+// =============================================================================
+class ReachabilityIndex : public IObserver {
+private:
+    IGridAdapter* grid;
+    const ObstacleBitGrid* occupancy;  // Bits de obstáculo do grid (sem chamada virtual)
+    GridType gridType;
+    int width;
+    int height;
+    std::vector<int32_t> labels;   // -1 = obstáculo
+    std::vector<int32_t> parent;   // union-find sobre os rótulos
+    uint64_t version = 0;
+
+    // Estado reaproveitado pelas BFSs de separação
+    std::vector<uint32_t> visitStamp;
+    std::vector<uint8_t> visitOwner;
+    uint32_t stamp = 0;
+
+    int indexOf(int x, int y) const { return y * width + x; }
+
+    int neighbors(int x, int y, Cell out[6]) const {
+        return GridTopology::neighbors(gridType, x, y, width, height, out);
+    }
+
+    int32_t find(int32_t label) {
+        while (parent[label] != label) {
+            parent[label] = parent[parent[label]];
+            label = parent[label];
+        }
+        return label;
+    }
+
+    int32_t newLabel() {
+        int32_t label = (int32_t)parent.size();
+        parent.push_back(label);
+        return label;
+    }
+
+    void flood(int startIndex, int32_t label) {
+        std::deque<int> queue;
+        labels[startIndex] = label;
+        queue.push_back(startIndex);
+        Cell adj[6];
+        while (!queue.empty()) {
+            int current = queue.front();
+            queue.pop_front();
+            int count = neighbors(current % width, current / width, adj);
+            for (int i = 0; i < count; ++i) {
+                int n = indexOf(adj[i].x, adj[i].y);
+                if (labels[n] != -1 || !occupancy->isWalkable(adj[i].x, adj[i].y)) continue;
+                labels[n] = label;
+                queue.push_back(n);
+            }
+        }
+    }
+
+    void onCellCleared(int x, int y) {
+        int index = indexOf(x, y);
+        if (labels[index] != -1) return;
+
+        Cell adj[6];
+        int count = neighbors(x, y, adj);
+        int32_t root = -1;
+        for (int i = 0; i < count; ++i) {
+            int32_t label = labels[indexOf(adj[i].x, adj[i].y)];
+            if (label == -1) continue;
+            int32_t other = find(label);
+            if (root == -1) {
+                root = other;
+            } else if (other != root) {
+                parent[other] = root;
+            }
+        }
+        if (root == -1) root = newLabel();  // Ilha nova de uma célula
+        labels[index] = root;
+        // Liberar sempre pode tornar algo alcançável (no mínimo a própria célula)
+        version++;
+    }
+
+    void onCellBlocked(int x, int y) {
+        int index = indexOf(x, y);
+        if (labels[index] == -1) return;
+        labels[index] = -1;
+
+        Cell adj[6];
+        int count = neighbors(x, y, adj);
+        int seeds[6];
+        int seedCount = 0;
+        for (int i = 0; i < count; ++i) {
+            int n = indexOf(adj[i].x, adj[i].y);
+            if (labels[n] != -1) seeds[seedCount++] = n;
+        }
+        if (seedCount <= 1) return;  // Remover uma ponta não separa nada
+
+        // BFSs intercaladas, uma por vizinho livre (buffers alocados na
+        // primeira separação)
+        if (visitStamp.size() != labels.size()) {
+            visitStamp.assign(labels.size(), 0);
+            visitOwner.assign(labels.size(), 0);
+            stamp = 0;
+        }
+        if (++stamp == 0) {
+            std::fill(visitStamp.begin(), visitStamp.end(), 0);
+            stamp = 1;
+        }
+        std::deque<int> queues[6];
+        std::vector<int> visited[6];
+        int group[6];
+        bool finished[6] = {false, false, false, false, false, false};
+        auto groupOf = [&group](int s) {
+            while (group[s] != s) s = group[s];
+            return s;
+        };
+
+        for (int s = 0; s < seedCount; ++s) {
+            group[s] = s;
+            int n = seeds[s];
+            if (visitStamp[n] == stamp) {
+                group[s] = groupOf(visitOwner[n]);
+                continue;
+            }
+            visitStamp[n] = stamp;
+            visitOwner[n] = (uint8_t)s;
+            queues[s].push_back(n);
+            visited[s].push_back(n);
+        }
+
+        auto activeGroups = [&]() {
+            int active = 0;
+            bool counted[6] = {false, false, false, false, false, false};
+            for (int s = 0; s < seedCount; ++s) {
+                int g = groupOf(s);
+                if (counted[g] || finished[g]) continue;
+                counted[g] = true;
+                active++;
+            }
+            return active;
+        };
+
+        while (activeGroups() > 1) {
+            for (int s = 0; s < seedCount; ++s) {
+                if (queues[s].empty()) continue;
+                int current = queues[s].front();
+                queues[s].pop_front();
+                int c = neighbors(current % width, current / width, adj);
+                for (int i = 0; i < c; ++i) {
+                    int n = indexOf(adj[i].x, adj[i].y);
+                    if (labels[n] == -1) continue;
+                    if (visitStamp[n] == stamp) {
+                        int a = groupOf(s);
+                        int b = groupOf(visitOwner[n]);
+                        if (a != b) group[b] = a;  // As duas BFSs estão na mesma região
+                        continue;
+                    }
+                    visitStamp[n] = stamp;
+                    visitOwner[n] = (uint8_t)s;
+                    queues[s].push_back(n);
+                    visited[s].push_back(n);
+                }
+            }
+
+            // Grupos cujas BFSs esvaziaram são regiões separadas: rótulo novo
+            for (int s = 0; s < seedCount; ++s) {
+                int g = groupOf(s);
+                if (finished[g]) continue;
+                bool exhausted = true;
+                for (int t = 0; t < seedCount && exhausted; ++t) {
+                    if (groupOf(t) == g && !queues[t].empty()) exhausted = false;
+                }
+                if (!exhausted || activeGroups() <= 1) continue;
+
+                finished[g] = true;
+                int32_t label = newLabel();
+                for (int t = 0; t < seedCount; ++t) {
+                    if (groupOf(t) != g) continue;
+                    for (int cell : visited[t]) labels[cell] = label;
+                }
+                version++;
+            }
+        }
+        // A região que continuou expandindo mantém o rótulo antigo
+    }
+
+public:
+    ReachabilityIndex(IGridAdapter* g, GridType type)
+        : grid(g), occupancy(&g->getOccupancy()), gridType(type), width(g->GetWidth()), height(g->GetHeight()) {
+        rebuild();
+    }
+
+    // Usa rótulos pré-calculados (mapa carregado de arquivo) em vez da BFS;
+    // rótulos fora de [-1, labelCount) ou em obstáculo descartam tudo e rebuild()
+    ReachabilityIndex(IGridAdapter* g, GridType type, const int32_t* precomputed, int32_t labelCount)
+        : grid(g), occupancy(&g->getOccupancy()), gridType(type), width(g->GetWidth()), height(g->GetHeight()) {
+        labels.assign(precomputed, precomputed + (size_t)width * height);
+        // Validação sem desvio por célula: acumula erros da linha inteira
+        bool valid = labelCount >= 0;
+        for (int y = 0; y < height && valid; ++y) {
+            const int32_t* row = &labels[(size_t)y * width];
+            bool bad = false;
+            for (int x = 0; x < width; ++x) {
+                bad |= (row[x] < -1) | (row[x] >= labelCount) | ((row[x] == -1) != occupancy->isBlocked(x, y));
+            }
+            valid = !bad;
+        }
+        if (!valid) {
+            rebuild();
+            return;
+        }
+        parent.resize(labelCount);
+        for (int32_t label = 0; label < labelCount; ++label) parent[label] = label;
+        version++;
+    }
+
+    // Rotula tudo do zero
+    void rebuild() {
+        labels.assign((size_t)width * height, -1);
+        parent.clear();
+        for (int y = 0; y < height; ++y) {
+            for (int x = 0; x < width; ++x) {
+                int index = indexOf(x, y);
+                if (labels[index] == -1 && occupancy->isWalkable(x, y)) {
+                    flood(index, newLabel());
+                }
+            }
+        }
+        version++;
+    }
+
+    int32_t getComponent(int x, int y) {
+        if (x < 0 || x >= width || y < 0 || y >= height) return -1;
+        int32_t label = labels[indexOf(x, y)];
+        return label == -1 ? -1 : find(label);
+    }
+
+    // O(1) (amortizado): existe caminho entre as duas células?
+    bool isReachable(Cell from, Cell to) {
+        int32_t a = getComponent(from.x, from.y);
+        return a != -1 && a == getComponent(to.x, to.y);
+    }
+
+    // Rótulos por célula com as uniões resolvidas e numerados de 0 a n-1
+    // (o formato gravado no MapFile); retorna n
+    int32_t exportLabels(std::vector<int32_t>& out) {
+        out.resize(labels.size());
+        std::vector<int32_t> renumbered(parent.size(), -1);
+        int32_t count = 0;
+        for (size_t index = 0; index < labels.size(); ++index) {
+            if (labels[index] == -1) {
+                out[index] = -1;
+                continue;
+            }
+            int32_t root = find(labels[index]);
+            if (renumbered[root] == -1) renumbered[root] = count++;
+            out[index] = renumbered[root];
+        }
+        return count;
+    }
+
+    uint64_t getVersion() const { return version; }
+
+    // O grid foi trocado (GRID_REPLACED): nada mais é alcançável e os eventos
+    // seguintes não são deste índice
+    void forgetGrid() {
+        grid = nullptr;
+        occupancy = nullptr;
+        std::fill(labels.begin(), labels.end(), -1);
+        version++;
+    }
+
+    void onNotify(const std::string& event, void* data) override {
+        if (!data) return;
+        if (event == GridEvents::OBSTACLE_CHANGED) {
+            auto* change = static_cast<GridChangeData*>(data);
+            if (change->grid != grid) return;
+            if (change->isObstacle) {
+                onCellBlocked(change->x, change->y);
+            } else {
+                onCellCleared(change->x, change->y);
+            }
+        } else if (event == GridEvents::REGION_CHANGED) {
+            if (static_cast<GridRegionData*>(data)->grid == grid) rebuild();
+        } else if (event == GridEvents::GRID_REPLACED) {
+            if (static_cast<GridReplacedData*>(data)->previous == grid) forgetGrid();
+        }
+    }
+};
+
+#endif // REACHABILITY_INDEX_H
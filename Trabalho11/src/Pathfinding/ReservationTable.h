@@ -0,0 +1,87 @@
+#ifndef RESERVATION_TABLE_H
+#define RESERVATION_TABLE_H
+
+#include <vector>
+#include <unordered_map>
+#include <algorithm>
+#include <cstdint>
+
+// =============================================================================
+// ReservationTable — Tabela de reservas espaço-tempo (célula, passo)
+// =============================================================================
+// Usada pelo planejamento cooperativo: cada agente reserva as células que vai
+// ocupar em cada passo da sua janela, e os próximos a planejar desviam delas.
+//
+// Só interessam os passos [agora, agora + profundidade): as reservas ficam num
+// anel de `depth` camadas (uma por passo), cada camada um mapa célula → agente.
+// Uma camada é limpa quando é reaproveitada para um passo novo, então passos
+// antigos somem sem varredura.
+//
+// Conflitos verificados:
+//   - vértice: duas reservas na mesma célula no mesmo passo;
+//   - aresta: dois agentes trocando de célula entre t e t+1 (A→B e B→A).
+// =============================================================================
+class ReservationTable {
+public:
+    static constexpr int FREE = -1;
+
+private:
+    int depth;
+    std::vector<std::unordered_map<int, int>> layers;  // [passo % depth]: célula → agente
+    std::vector<uint32_t> layerTime;                  // Passo que cada camada representa
+
+    std::unordered_map<int, int>& layerFor(uint32_t time) {
+        int slot = (int)(time % depth);
+        if (layerTime[slot] != time) {
+            layers[slot].clear();
+            layerTime[slot] = time;
+        }
+        return layers[slot];
+    }
+
+public:
+    explicit ReservationTable(int layerCount)
+        : depth(layerCount < 1 ? 1 : layerCount), layers(depth), layerTime(depth, UINT32_MAX) {}
+
+    // Dono da célula no passo `time` (FREE se ninguém reservou)
+    int owner(int cell, uint32_t time) const {
+        int slot = (int)(time % depth);
+        if (layerTime[slot] != time) return FREE;
+        auto it = layers[slot].find(cell);
+        return it == layers[slot].end() ? FREE : it->second;
+    }
+
+    bool isFree(int cell, uint32_t time, int agent) const {
+        int current = owner(cell, time);
+        return current == FREE || current == agent;
+    }
+
+    // `agent` pode ir de `from` (passo time) para `to` (passo time+1)?
+    bool canMove(int from, int to, uint32_t time, int agent) const {
+        if (!isFree(to, time + 1, agent)) return false;
+        if (from == to) return true;
+        int ahead = owner(to, time);
+        return ahead == FREE || ahead == agent || owner(from, time + 1) != ahead;
+    }
+
+    // O chamador garante time ∈ [agora, agora + depth)
+    void reserve(int cell, uint32_t time, int agent) {
+        layerFor(time)[cell] = agent;
+    }
+
+    void release(int cell, uint32_t time, int agent) {
+        int slot = (int)(time % depth);
+        if (layerTime[slot] != time) return;
+        auto it = layers[slot].find(cell);
+        if (it != layers[slot].end() && it->second == agent) layers[slot].erase(it);
+    }
+
+    void clear() {
+        for (auto& layer : layers) layer.clear();
+        std::fill(layerTime.begin(), layerTime.end(), UINT32_MAX);
+    }
+
+    int getDepth() const { return depth; }
+};
+
+#endif // RESERVATION_TABLE_H
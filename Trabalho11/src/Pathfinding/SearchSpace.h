@@ -0,0 +1,107 @@
+#ifndef SEARCH_SPACE_H
+#define SEARCH_SPACE_H
+
+#include <memory>
+#include <cstdlib>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <new>
+#include <type_traits>
+
+// =============================================================================
+// SearchSpace — Armazenamento plano dos nós de busca com carimbo de geração
+// =============================================================================
+// Cada célula do grid tem um SearchNode numa única std::vector (índice = y*W+x).
+// Em vez de zerar todos os W×H nós no início de cada consulta (como fazia o
+// Grid::ResetPathfindingData), cada nó guarda a geração da consulta em que foi
+// tocado pela última vez. Um nó com geração antiga é tratado como "novo"
+// e só é reinicializado quando a busca realmente o alcança.
+//
+// Um nó todo zerado (geração 0) vale como "nunca tocado", então o vetor é
+// alocado com calloc em vez de preenchido: o sistema só entrega memória real
+// às páginas que as buscas escrevem. Num mapa de 2000×2000 (~96 MB de nós)
+// cada motor ocupa só a área que suas buscas visitaram, sem indireção extra
+// no acesso.
+// =============================================================================
+
+// Estado do nó dentro da consulta corrente
+enum class NodeState : uint8_t {
+    UNVISITED = 0,
+    OPEN = 1,
+    CLOSED = 2
+};
+
+struct SearchNode {
+    float g;              // Custo acumulado desde a origem
+    float f;              // g + heurística
+    int32_t parent;       // Índice do nó pai (-1 = sem pai)
+    int32_t heapIndex;    // Posição no heap aberto (-1 = fora do heap)
+    uint32_t generation;  // Consulta em que o nó foi tocado pela última vez
+    NodeState state;
+};
+
+static_assert(std::is_trivially_copyable<SearchNode>::value,
+              "SearchSpace aloca os nós zerados com calloc");
+
+class SearchSpace {
+private:
+    struct FreeDeleter {
+        void operator()(SearchNode* p) const { std::free(p); }
+    };
+
+    std::unique_ptr<SearchNode[], FreeDeleter> nodes;
+    size_t count = 0;
+    uint32_t generation = 0;
+    int width = 0;
+    int height = 0;
+
+public:
+    // Garante espaço para um grid W×H (só realoca se o tamanho mudar)
+    void resize(int w, int h) {
+        if (w == width && h == height) return;
+        width = w;
+        height = h;
+        count = static_cast<size_t>(w) * static_cast<size_t>(h);
+        nodes.reset(static_cast<SearchNode*>(std::calloc(count ? count : 1, sizeof(SearchNode))));
+        if (!nodes) throw std::bad_alloc();
+        generation = 0;
+    }
+
+    // Inicia uma nova consulta: O(1), exceto quando o contador dá a volta
+    void beginQuery() {
+        if (++generation == 0) {
+            std::memset(static_cast<void*>(nodes.get()), 0, count * sizeof(SearchNode));
+            generation = 1;
+        }
+    }
+
+    // Acessa o nó, reinicializando-o preguiçosamente se for de outra consulta
+    SearchNode& touch(int index) {
+        SearchNode& node = nodes[index];
+        if (node.generation != generation) {
+            node.generation = generation;
+            node.g = std::numeric_limits<float>::infinity();
+            node.f = std::numeric_limits<float>::infinity();
+            node.parent = -1;
+            node.heapIndex = -1;
+            node.state = NodeState::UNVISITED;
+        }
+        return node;
+    }
+
+    // Acesso direto (o chamador garante que o nó já foi tocado nesta consulta)
+    SearchNode& operator[](int index) { return nodes[index]; }
+    const SearchNode& operator[](int index) const { return nodes[index]; }
+
+    bool isCurrent(int index) const { return nodes[index].generation == generation; }
+
+    int getWidth() const { return width; }
+    int getHeight() const { return height; }
+    int indexOf(int x, int y) const { return y * width + x; }
+    int xOf(int index) const { return index % width; }
+    int yOf(int index) const { return index / width; }
+};
+
+#endif // SEARCH_SPACE_H
@@ -0,0 +1,168 @@
+#ifndef SLICED_ASTAR_H
+#define SLICED_ASTAR_H
+
+#include "src/Pathfinding/SearchSpace.h"
+#include "src/Pathfinding/IndexedBinaryHeap.h"
+#include "src/Pathfinding/GridTopology.h"
+#include "src/Pathfinding/LandmarkTable.h"
+#include "src/Interfaces/IGridAdapter.h"
+#include "src/Core/Cell.h"
+#include "src/Core/GridType.h"
+#include <vector>
+#include <memory>
+#include <algorithm>
+
+// =============================================================================
+// SlicedAStar — A* retomável, executado em fatias de N expansões
+// =============================================================================
+// Mesma estrutura do GridAStar (heap indexado + nós com carimbo de geração),
+// mas o laço principal foi quebrado: begin() prepara a busca e step(n) expande
+// no máximo n nós e devolve o controle. A lista aberta e os nós ficam no
+// objeto entre uma chamada e outra, então a busca continua de onde parou no
+// frame seguinte.
+//
+// Vizinhança: 4 direções no retangular, 6 (odd-q) no hexagonal; heurística
+// Manhattan ou distância hexagonal, conforme o grid, ou a ALT se begin()
+// recebeu uma LandmarkTable (guardada até a busca acabar, já que ela dura
+// vários frames). step() escolhe a topologia uma vez e roda o laço
+// instanciado para ela (stepWith).
+// =============================================================================
+class SlicedAStar {
+public:
+    enum class Status { IDLE, RUNNING, FOUND, FAILED };
+
+private:
+    SearchSpace space;
+    IndexedBinaryHeap open;
+    IGridAdapter* grid = nullptr;
+    const ObstacleBitGrid* occupancy = nullptr;  // Bits de obstáculo do grid atual
+    GridType gridType = GridType::RECTANGULAR;
+    Cell start = {0, 0};
+    Cell goal = {0, 0};
+    int goalIndex = -1;
+    int expandedNodes = 0;
+    Status status = Status::IDLE;
+    std::shared_ptr<const LandmarkTable> landmarks;
+
+    bool isWalkable(int x, int y) const {
+        return occupancy->isWalkable(x, y);
+    }
+
+    float heuristic(int x, int y) const {
+        if (landmarks) return landmarks->estimate(x, y, goal.x, goal.y);
+        return gridType == GridType::HEXAGONAL ?
+            GridTopology::HexOddQ::heuristic(x, y, goal.x, goal.y) :
+            GridTopology::Rect4::heuristic(x, y, goal.x, goal.y);
+    }
+
+    template <typename Topology>
+    int stepWith(int maxExpansions) {
+        int done = 0;
+        while (status == Status::RUNNING && done < maxExpansions) {
+            if (open.empty()) {
+                status = Status::FAILED;
+                break;
+            }
+            int current = open.pop();
+            SearchNode& currentNode = space[current];
+            currentNode.state = NodeState::CLOSED;
+            done++;
+
+            if (current == goalIndex) {
+                status = Status::FOUND;
+                break;
+            }
+
+            int cx = space.xOf(current);
+            int cy = space.yOf(current);
+            float newG = currentNode.g + 1.0f;
+
+            const int (*dirs)[2];
+            int dirCount = Topology::directions(cx, dirs);
+            for (int i = 0; i < dirCount; ++i) {
+                int nx = cx + dirs[i][0];
+                int ny = cy + dirs[i][1];
+                if (!isWalkable(nx, ny)) continue;
+
+                int neighborIndex = space.indexOf(nx, ny);
+                SearchNode& neighbor = space.touch(neighborIndex);
+                if (neighbor.state == NodeState::CLOSED || newG >= neighbor.g) continue;
+
+                neighbor.g = newG;
+                neighbor.f = newG + (landmarks ? landmarks->estimate(nx, ny, goal.x, goal.y) :
+                                                 Topology::heuristic(nx, ny, goal.x, goal.y));
+                neighbor.parent = current;
+                if (neighbor.state == NodeState::OPEN) {
+                    open.decreaseKey(neighborIndex);
+                } else {
+                    neighbor.state = NodeState::OPEN;
+                    open.push(neighborIndex);
+                }
+            }
+        }
+        expandedNodes += done;
+        return done;
+    }
+
+public:
+    void begin(IGridAdapter* g, GridType type, Cell from, Cell to,
+               std::shared_ptr<const LandmarkTable> table = nullptr) {
+        grid = g;
+        occupancy = &g->getOccupancy();
+        gridType = type;
+        start = from;
+        goal = to;
+        expandedNodes = 0;
+        landmarks = std::move(table);
+
+        space.resize(g->GetWidth(), g->GetHeight());
+        if (!isWalkable(start.x, start.y) || !isWalkable(goal.x, goal.y)) {
+            status = Status::FAILED;
+            return;
+        }
+
+        space.beginQuery();
+        open.reset(space);
+        goalIndex = space.indexOf(goal.x, goal.y);
+
+        int startIndex = space.indexOf(start.x, start.y);
+        SearchNode& startNode = space.touch(startIndex);
+        startNode.g = 0.0f;
+        startNode.f = heuristic(start.x, start.y);
+        startNode.state = NodeState::OPEN;
+        open.push(startIndex);
+        status = Status::RUNNING;
+    }
+
+    // Expande até `maxExpansions` nós; retorna quantos expandiu de fato
+    int step(int maxExpansions) {
+        return GridTopology::dispatch(gridType, [this, maxExpansions](auto topology) {
+            return this->template stepWith<decltype(topology)>(maxExpansions);
+        });
+    }
+
+    // Caminho encontrado (origem e destino inclusos); vazio se não FOUND
+    std::vector<Cell> getPath() const {
+        std::vector<Cell> path;
+        if (status != Status::FOUND) return path;
+        for (int index = goalIndex; index != -1; index = space[index].parent) {
+            path.push_back({space.xOf(index), space.yOf(index)});
+        }
+        std::reverse(path.begin(), path.end());
+        return path;
+    }
+
+    void cancel() {
+        status = Status::IDLE;
+        landmarks.reset();
+    }
+
+    Status getStatus() const { return status; }
+    bool isRunning() const { return status == Status::RUNNING; }
+    bool isDone() const { return status == Status::FOUND || status == Status::FAILED; }
+    Cell getStart() const { return start; }
+    Cell getGoal() const { return goal; }
+    int getExpandedNodes() const { return expandedNodes; }
+};
+
+#endif // SLICED_ASTAR_H